@@ -38,6 +38,14 @@ CPMDeclarePackage (googletest
                    GITHUB_REPOSITORY google/googletest
                    SYSTEM TRUE
                    OPTIONS "BUILD_GMOCK OFF" "INSTALL_GTEST OFF" "CMAKE_MESSAGE_LOG_LEVEL WARNING")
+# benchmark
+set (SHARG_BENCHMARK_VERSION 1.9.4 CACHE STRING "")
+CPMDeclarePackage (benchmark
+                   NAME benchmark
+                   VERSION ${SHARG_BENCHMARK_VERSION}
+                   GITHUB_REPOSITORY google/benchmark
+                   SYSTEM TRUE
+                   OPTIONS "BENCHMARK_ENABLE_TESTING OFF" "BENCHMARK_ENABLE_WERROR OFF" "CMAKE_MESSAGE_LOG_LEVEL WARNING")
 # doxygen-awesome
 set (SHARG_DOXYGEN_AWESOME_VERSION 2.4.2 CACHE STRING "")
 CPMDeclarePackage (doxygen_awesome
@@ -150,6 +150,8 @@ set (CMAKE_REQUIRED_FLAGS ${CMAKE_CXX_FLAGS})
 # ----------------------------------------------------------------------------
 
 option (SHARG_NO_TDL "Do not use TDL, even if present." OFF)
+option (SHARG_DISABLE_VERSION_CHECK "Compile out the update notifications of the sharg::parser." OFF)
+option (SHARG_WITH_USDT "Add USDT probes for perf and bpftrace to the sharg::parser (requires <sys/sdt.h>)." OFF)
 
 # ----------------------------------------------------------------------------
 # Check supported compilers
@@ -205,6 +207,36 @@ else ()
     list (APPEND SHARG_DEFINITIONS "-DSHARG_HAS_TDL=0")
 endif ()
 
+# ----------------------------------------------------------------------------
+# update notifications
+# ----------------------------------------------------------------------------
+
+if (SHARG_DISABLE_VERSION_CHECK)
+    sharg_config_print ("Update notifications:       deactivated.")
+    list (APPEND SHARG_DEFINITIONS "-DSHARG_DISABLE_VERSION_CHECK=1")
+else ()
+    sharg_config_print ("Update notifications:       activated.")
+endif ()
+
+# ----------------------------------------------------------------------------
+# USDT probes
+# ----------------------------------------------------------------------------
+
+if (SHARG_WITH_USDT)
+    check_include_file_cxx (sys/sdt.h SHARG_HAS_SYS_SDT_H)
+
+    if (SHARG_HAS_SYS_SDT_H)
+        sharg_config_print ("Optional dependency:        USDT probes activated.")
+        list (APPEND SHARG_DEFINITIONS "-DSHARG_HAS_USDT=1")
+    else ()
+        sharg_config_print ("Optional dependency:        USDT probes not found (<sys/sdt.h> is missing).")
+        list (APPEND SHARG_DEFINITIONS "-DSHARG_HAS_USDT=0")
+    endif ()
+else ()
+    sharg_config_print ("Optional dependency:        USDT probes deactivated.")
+    list (APPEND SHARG_DEFINITIONS "-DSHARG_HAS_USDT=0")
+endif ()
+
 # ----------------------------------------------------------------------------
 # System dependencies
 # ----------------------------------------------------------------------------
@@ -53,4 +53,7 @@
 #include <sharg/auxiliary.hpp>
 #include <sharg/exceptions.hpp>
 #include <sharg/parser.hpp>
+#include <sharg/parser_schema.hpp>
+#include <sharg/static_schema.hpp>
+#include <sharg/string_pool.hpp>
 #include <sharg/validators.hpp>
@@ -29,6 +29,40 @@ enum class update_notifications : uint8_t
     off //!< Automatic update notifications should be disabled.
 };
 
+/*!\brief Indicates whether and how the sharg::parser expands response files, i.e. `@file` arguments.
+ * \ingroup misc
+ * \sa sharg::parser::set_response_file_mode
+ * \details
+ * \experimentalapi{Experimental since version 1.2.3.}
+ */
+enum class response_file_mode : uint8_t
+{
+    off,     //!< `@file` is an ordinary argument (default).
+    newline, //!< Each line of the file is one argument.
+    null,    //!< The arguments are separated by NUL characters, e.g. the output of `find -print0`.
+    shell    //!< The arguments are separated by whitespace and may be quoted or escaped as in a POSIX shell.
+};
+
+/*!\brief Tag type of sharg::borrow_arguments.
+ * \ingroup misc
+ * \details
+ * \experimentalapi{Experimental since version 1.2.3.}
+ */
+struct borrow_arguments_t
+{
+    explicit borrow_arguments_t() = default; //!< Defaulted.
+};
+
+/*!\brief Constructs a sharg::parser that refers to `argv` instead of copying the arguments.
+ * \ingroup misc
+ * \details
+ *
+ * The strings pointed to by `argv` must outlive the parser. This is always the case for the `argv` passed to `main`.
+ *
+ * \experimentalapi{Experimental since version 1.2.3.}
+ */
+inline constexpr borrow_arguments_t borrow_arguments{};
+
 /*!\brief A `std::vector<std::string>` that can also be constructed from `std::string`.
  * \ingroup misc
  * \details
@@ -11,6 +11,7 @@
 
 #include <concepts>
 
+#include <sharg/detail/concept.hpp>
 #include <sharg/enumeration_names.hpp>
 
 namespace sharg
@@ -82,13 +83,19 @@ concept ostreamable = requires (std::ostream & os, type & val)
  *
  * In order to model this concept, the type must either model sharg::istreamable and sharg::ostreamable or
  * model sharg::named_enumeration<option_type>.
+ * Instead of sharg::istreamable, the type may provide a `from_chars` function in sharg::custom::parsing, be a
+ * std::chrono::duration, or be constructible from a std::string_view, e.g. std::filesystem::path.
+ * Types that refer to memory they do not own, e.g. std::string_view, do not model this concept, because they would
+ * refer to the command line arguments stored by the parser. sharg::string_pool models this concept.
  *
  * \remark For a complete overview, take a look at \ref parser
  *
  * \stableapi{Since version 1.0.}
  */
 template <typename option_type>
-concept parsable =
-    (sharg::istreamable<option_type> && sharg::ostreamable<option_type>) || named_enumeration<option_type>;
+concept parsable = ((sharg::istreamable<option_type> || detail::has_custom_from_chars<option_type>
+                    || detail::is_duration<option_type> || detail::string_view_constructible_option<option_type>)
+                   && sharg::ostreamable<option_type> && !detail::non_owning_option<option_type>)
+                || named_enumeration<option_type> || detail::string_pool_option<option_type>;
 
 } // namespace sharg
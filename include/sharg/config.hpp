@@ -34,6 +34,8 @@ namespace sharg
  * | sharg::config::hidden               |           ✓          |      ✓      |              X            |
  * | sharg::config::required             |           ✓          |      ✓      |             (✓)           |
  * | sharg::config::validator            |           ✓          |     (✓)     |              ✓            |
+ * | sharg::config::parallel_validation  |           ✓          |     (✓)     |              ✓            |
+ * | sharg::config::list_delimiter       |     ✓ (container)    |      X      |              X            |
  *
  * \details
  * \stableapi{Since version 1.0.}
@@ -133,6 +135,41 @@ struct config
      * \stableapi{Since version 1.0.}
      */
     validator_t validator{};
+
+    /*!\brief Whether the values of a container option are validated in parallel.
+     *
+     * If set to true, the sharg::config::validator is applied to the values of a container option or positional
+     * list option by a pool of `std::thread::hardware_concurrency()` threads. This speeds up validators that access
+     * the file system, e.g. the sharg::input_file_validator for many files on a network file system.
+     *
+     * The validation stops early after the first invalid value. The reported error is the one of the first invalid
+     * value on the command line, i.e. the same as for sequential validation.
+     *
+     * \attention The validator must be safe to call concurrently. The validators provided by sharg are.
+     *            Usually, the sharg::output_file_validator only queries the file system. Where this is not
+     *            available, e.g. on systems without `statx`, it falls back to creating and removing each file; only
+     *            then, a file that is given twice may be reported as already existing.
+     *
+     * The parameter has no effect on flags and options that are no container.
+     *
+     * \experimentalapi{Experimental since version 1.2.3.}
+     */
+    bool parallel_validation{false};
+
+    /*!\brief The character separating the values of a container option in a single argument, e.g. ','.
+     *
+     * If set, every value given for the option is split at this character, such that `--ids 1,2,3` is the same as
+     * `--ids 1 --ids 2 --ids 3`. Both forms may be mixed. Empty values, e.g. in `--ids 1,,2` or `--ids ''`, are
+     * parsed like any other value; for numbers, they are invalid.
+     *
+     * By default (`'\0'`), values are not split.
+     *
+     * \attention This parameter can only be set for options whose value is a container. Setting it for flags,
+     *            positional options, or options that are no container will trigger a sharg::design_error.
+     *
+     * \experimentalapi{Experimental since version 1.2.3.}
+     */
+    char list_delimiter{'\0'};
 };
 
 } // namespace sharg
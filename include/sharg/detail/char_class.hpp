@@ -0,0 +1,114 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \author Enrico Seiler <enrico.seiler AT fu-berlin.de>
+ * \brief Provides sharg::detail::char_class and the character classes of names and version numbers.
+ */
+
+#pragma once
+
+#include <array>
+#include <string_view>
+
+#include <sharg/platform.hpp>
+
+namespace sharg::detail
+{
+
+/*!\brief A set of characters with constant time lookup that is constructed at compile time.
+ * \ingroup misc
+ *
+ * \details
+ *
+ * Replaces regular expressions of the form `^[<characters>]+$`, which are expensive to construct.
+ */
+class char_class
+{
+public:
+    /*!\brief Constructs the set of the characters in `members`.
+     * \param[in] members The characters of the set.
+     */
+    explicit consteval char_class(std::string_view const members)
+    {
+        for (char const c : members)
+            table[static_cast<unsigned char>(c)] = true;
+    }
+
+    //!\brief Whether `c` is in the set.
+    constexpr bool contains(char const c) const noexcept
+    {
+        return table[static_cast<unsigned char>(c)];
+    }
+
+    //!\brief Returns the length of the longest prefix of `str` that only consists of characters in the set.
+    constexpr size_t prefix_length(std::string_view const str) const noexcept
+    {
+        size_t length{};
+
+        while (length < str.size() && contains(str[length]))
+            ++length;
+
+        return length;
+    }
+
+    //!\brief Whether `str` is not empty and only consists of characters in the set, i.e. matches `^[<members>]+$`.
+    constexpr bool matches(std::string_view const str) const noexcept
+    {
+        return !str.empty() && prefix_length(str) == str.size();
+    }
+
+private:
+    //!\brief Whether a character, cast to `unsigned char`, is in the set.
+    std::array<bool, 256> table{};
+};
+
+//!\brief The characters of application and subcommand names, i.e. `[a-zA-Z0-9_-]`.
+inline constexpr char_class app_name_chars{"abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789_-"};
+
+//!\brief The decimal digits, i.e. `[[:digit:]]`.
+inline constexpr char_class digit_chars{"0123456789"};
+
+/*!\brief Returns the length of the version number `<major>.<minor>.<patch>` at the start of `str`.
+ * \ingroup misc
+ * \param[in] str The string to check.
+ * \returns The length of the match of `^[[:digit:]]+\.[[:digit:]]+\.[[:digit:]]+`; `0` if `str` does not start with a
+ *          version number.
+ */
+constexpr size_t version_prefix_length(std::string_view const str) noexcept
+{
+    size_t length{};
+
+    for (size_t part = 0; part < 3u; ++part)
+    {
+        if (part != 0u)
+        {
+            if (length == str.size() || str[length] != '.')
+                return 0u;
+
+            ++length;
+        }
+
+        size_t const digits = digit_chars.prefix_length(str.substr(length));
+
+        if (digits == 0u)
+            return 0u;
+
+        length += digits;
+    }
+
+    return length;
+}
+
+/*!\brief Whether `str` is a version number `<major>.<minor>.<patch>`.
+ * \ingroup misc
+ * \param[in] str The string to check.
+ * \returns Whether `str` matches `^[[:digit:]]+\.[[:digit:]]+\.[[:digit:]]+$`.
+ */
+constexpr bool is_version_number(std::string_view const str) noexcept
+{
+    return version_prefix_length(str) == str.size() && !str.empty();
+}
+
+} // namespace sharg::detail
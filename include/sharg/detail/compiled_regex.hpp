@@ -0,0 +1,446 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \author Enrico Seiler <enrico.seiler AT fu-berlin.de>
+ * \brief Provides sharg::detail::regex_automaton and sharg::detail::compiled_regex.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bitset>
+#include <cstdint>
+#include <exception>
+#include <optional>
+#include <regex>
+#include <string>
+#include <string_view>
+
+#include <sharg/platform.hpp>
+
+namespace sharg::detail
+{
+
+/*!\brief A bit-parallel automaton for regular expressions that are a sequence of quantified character classes.
+ * \ingroup misc
+ *
+ * \details
+ *
+ * Covers patterns like `^chr[0-9XYM]+$`, `[a-zA-Z0-9_.-]{1,32}` or `\d+\.\d+`, i.e. an optionally anchored sequence
+ * of literals, `.`, escapes (`\d`, `\w`, `\s`, their negations and escaped punctuation) and bracket expressions
+ * (ranges, negation and escapes), each optionally followed by `*`, `+`, `?`, `{n}`, `{n,}` or `{n,m}`.
+ * The pattern is matched against the whole string, like `std::regex_match` with `std::regex::ECMAScript` in the
+ * "C" locale.
+ *
+ * Each quantified atom is expanded into at most 63 positions. The set of active positions is stored in the bits of a
+ * single integer, such that matching a character costs one table lookup and a few bit operations, like a DFA.
+ * The automaton has no state besides the input position and is therefore safe to use concurrently.
+ */
+class regex_automaton
+{
+public:
+    /*!\brief Compiles `pattern` into an automaton.
+     * \param[in] pattern The regular expression.
+     * \returns The automaton, or `std::nullopt` if the pattern uses any other feature, e.g. groups, alternatives,
+     *          back-references or POSIX classes, or is invalid. The caller then needs to use `std::regex`.
+     */
+    static std::optional<regex_automaton> compile(std::string_view const pattern)
+    {
+        regex_automaton automaton{};
+        size_t i{};
+
+        if (pattern.starts_with('^'))
+            ++i;
+
+        while (i < pattern.size())
+        {
+            if (pattern[i] == '$' && i + 1u == pattern.size())
+                break;
+
+            std::bitset<256> characters{};
+            size_t min{1u};
+            size_t max{1u};
+
+            if (!parse_atom(pattern, i, characters) || !parse_quantifier(pattern, i, min, max)
+                || !automaton.append(characters, min, max))
+                return std::nullopt;
+        }
+
+        automaton.accept = uint64_t{1u} << automaton.position_count;
+        automaton.initial = automaton.close(uint64_t{1u});
+        return automaton;
+    }
+
+    //!\brief Whether the whole `value` matches the pattern.
+    bool matches(std::string_view const value) const noexcept
+    {
+        uint64_t active = initial;
+
+        for (char const c : value)
+        {
+            uint64_t const mask = transitions[static_cast<unsigned char>(c)];
+            active = ((active << 1) & mask) | (active & repeatable & mask);
+
+            if (active == 0u)
+                return false;
+
+            active = close(active);
+        }
+
+        return active & accept;
+    }
+
+private:
+    //!\brief Used to mark an unbounded quantifier.
+    static constexpr size_t unbounded{static_cast<size_t>(-1)};
+
+    //!\brief The maximum number of positions; bit `0` is the state before the first position.
+    static constexpr size_t max_positions{63u};
+
+    /*!\brief Bit `i + 1` is set in `transitions[c]` if position `i` matches the character `c`.
+     * \details
+     * Bit `i + 1` of the active states means that position `i` was the last position that matched a character.
+     */
+    std::array<uint64_t, 256> transitions{};
+    uint64_t repeatable{};   //!< Bit `i + 1` is set if position `i` may match more than once.
+    uint64_t skippable{};    //!< Bit `i + 1` is set if position `i` may match no character.
+    uint64_t accept{};       //!< The bit of the last position.
+    uint64_t initial{};      //!< The states active before the first character.
+    size_t position_count{}; //!< The number of positions.
+
+    //!\brief Adds the positions that skipping optional positions reaches from `active`.
+    uint64_t close(uint64_t active) const noexcept
+    {
+        for (uint64_t next = active | ((active << 1) & skippable); next != active;
+             next = active | ((active << 1) & skippable))
+            active = next;
+
+        return active;
+    }
+
+    //!\brief Appends the positions of a character class that is quantified by `{min,max}`.
+    bool append(std::bitset<256> const & characters, size_t const min, size_t const max)
+    {
+        size_t const count = (max == unbounded) ? std::max<size_t>(min, 1u) : max;
+
+        if (count > max_positions - position_count)
+            return false;
+
+        for (size_t copy = 0; copy < count; ++copy)
+        {
+            uint64_t const bit = uint64_t{1u} << ++position_count;
+
+            for (size_t c = 0; c < characters.size(); ++c)
+                if (characters[c])
+                    transitions[c] |= bit;
+
+            if (copy >= min)
+                skippable |= bit;
+            if (max == unbounded && copy + 1u == count)
+                repeatable |= bit;
+        }
+
+        return true;
+    }
+
+    //!\brief Adds the characters of a predefined class, e.g. `\d`, to `characters`.
+    static bool add_class_escape(char const escape, std::bitset<256> & characters)
+    {
+        std::bitset<256> members{};
+
+        for (size_t c = 0; c < members.size(); ++c)
+        {
+            bool const is_digit = c >= '0' && c <= '9';
+            bool const is_word = is_digit || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_';
+            bool const is_space = c == ' ' || (c >= '\t' && c <= '\r');
+
+            switch (escape)
+            {
+                case 'd':
+                case 'D':
+                    members[c] = is_digit;
+                    break;
+                case 'w':
+                case 'W':
+                    members[c] = is_word;
+                    break;
+                case 's':
+                case 'S':
+                    members[c] = is_space;
+                    break;
+                default:
+                    return false;
+            }
+        }
+
+        characters |= (escape >= 'A' && escape <= 'Z') ? ~members : members;
+        return true;
+    }
+
+    //!\brief Returns the character of a character escape, e.g. `\t` or `\.`; `std::nullopt` for any other escape.
+    static std::optional<char> character_escape(char const escape)
+    {
+        switch (escape)
+        {
+            case 't':
+                return '\t';
+            case 'n':
+                return '\n';
+            case 'r':
+                return '\r';
+            case 'f':
+                return '\f';
+            case 'v':
+                return '\v';
+        }
+
+        bool const is_alnum = (escape >= '0' && escape <= '9') || (escape >= 'a' && escape <= 'z')
+                           || (escape >= 'A' && escape <= 'Z');
+
+        if (is_alnum || static_cast<unsigned char>(escape) >= 0x80)
+            return std::nullopt;
+
+        return escape;
+    }
+
+    //!\brief Parses a literal, `.`, an escape or a bracket expression at `i`.
+    static bool parse_atom(std::string_view const pattern, size_t & i, std::bitset<256> & characters)
+    {
+        char const c = pattern[i++];
+
+        switch (c)
+        {
+            case '.':
+                characters.set();
+                characters.reset('\n');
+                characters.reset('\r');
+                return true;
+            case '[':
+                return parse_bracket(pattern, i, characters);
+            case '\\':
+            {
+                if (i == pattern.size())
+                    return false;
+
+                char const escape = pattern[i++];
+
+                if (add_class_escape(escape, characters))
+                    return true;
+
+                std::optional<char> const literal = character_escape(escape);
+                if (literal)
+                    characters.set(static_cast<unsigned char>(*literal));
+                return literal.has_value();
+            }
+            case '^':
+            case '$':
+            case '*':
+            case '+':
+            case '?':
+            case '(':
+            case ')':
+            case ']':
+            case '{':
+            case '}':
+            case '|':
+                return false;
+            default:
+                characters.set(static_cast<unsigned char>(c));
+                return true;
+        }
+    }
+
+    //!\brief Parses the bracket expression following the `[` in front of `i`.
+    static bool parse_bracket(std::string_view const pattern, size_t & i, std::bitset<256> & characters)
+    {
+        bool const negate = i < pattern.size() && pattern[i] == '^';
+        i += negate;
+
+        if (i < pattern.size() && pattern[i] == ']') // `[]` and `[^]` are not handled.
+            return false;
+
+        std::bitset<256> members{};
+
+        // Parses a single character at `i`. Returns std::nullopt for class escapes, which are added to members.
+        auto parse_character = [&](bool & valid) -> std::optional<char>
+        {
+            char const c = pattern[i++];
+            valid = c != '[';
+
+            if (c != '\\')
+                return c;
+
+            valid = i < pattern.size();
+            if (!valid)
+                return std::nullopt;
+
+            char const escape = pattern[i++];
+            if (add_class_escape(escape, members))
+                return std::nullopt;
+
+            std::optional<char> const literal = character_escape(escape);
+            valid = literal.has_value();
+            return literal;
+        };
+
+        while (i < pattern.size() && pattern[i] != ']')
+        {
+            bool valid{};
+            std::optional<char> const first = parse_character(valid);
+
+            if (!valid)
+                return false;
+
+            if (i + 1u < pattern.size() && pattern[i] == '-' && pattern[i + 1u] != ']') // A range.
+            {
+                ++i;
+                std::optional<char> const last = parse_character(valid);
+
+                if (!valid || !first || !last || static_cast<unsigned char>(*first) >= 0x80
+                    || static_cast<unsigned char>(*last) >= 0x80 || *first > *last)
+                    return false;
+
+                for (int c = *first; c <= *last; ++c)
+                    members.set(static_cast<unsigned char>(c));
+            }
+            else if (first)
+            {
+                members.set(static_cast<unsigned char>(*first));
+            }
+        }
+
+        if (i == pattern.size()) // Unterminated bracket expression.
+            return false;
+
+        ++i;
+        characters |= negate ? ~members : members;
+        return true;
+    }
+
+    //!\brief Parses an optional quantifier at `i`.
+    static bool parse_quantifier(std::string_view const pattern, size_t & i, size_t & min, size_t & max)
+    {
+        if (i == pattern.size())
+            return true;
+
+        switch (pattern[i])
+        {
+            case '*':
+                min = 0u;
+                max = unbounded;
+                break;
+            case '+':
+                max = unbounded;
+                break;
+            case '?':
+                min = 0u;
+                break;
+            case '{':
+                return parse_interval(pattern, ++i, min, max);
+            default:
+                return true;
+        }
+
+        ++i;
+        return true;
+    }
+
+    //!\brief Parses the `n}`, `n,}` or `n,m}` following the `{` in front of `i`.
+    static bool parse_interval(std::string_view const pattern, size_t & i, size_t & min, size_t & max)
+    {
+        auto parse_number = [&](size_t & number)
+        {
+            size_t const begin = i;
+            number = 0u;
+
+            for (; i < pattern.size() && pattern[i] >= '0' && pattern[i] <= '9' && number <= max_positions; ++i)
+                number = number * 10u + (pattern[i] - '0');
+
+            return i != begin && number <= max_positions;
+        };
+
+        if (!parse_number(min))
+            return false;
+
+        max = min;
+
+        if (i < pattern.size() && pattern[i] == ',')
+        {
+            ++i;
+            max = unbounded;
+
+            if (i < pattern.size() && pattern[i] != '}' && (!parse_number(max) || max < min))
+                return false;
+        }
+
+        if (i == pattern.size() || pattern[i] != '}')
+            return false;
+
+        ++i;
+        return true;
+    }
+};
+
+/*!\brief A regular expression that is compiled once and matched against whole strings.
+ * \ingroup misc
+ *
+ * \details
+ *
+ * Uses sharg::detail::regex_automaton if it covers the pattern and `std::regex` otherwise.
+ * If `std::regex` rejects the pattern, the `std::regex_error` is thrown by matches(), not by the constructor.
+ * Matching is safe to do concurrently.
+ */
+class compiled_regex
+{
+public:
+    /*!\brief Compiles `pattern`.
+     * \param[in] pattern The regular expression in ECMAScript syntax.
+     */
+    explicit compiled_regex(std::string const & pattern) : automaton{regex_automaton::compile(pattern)}
+    {
+        if (automaton)
+            return;
+
+        try
+        {
+            regex.emplace(pattern);
+        }
+        catch (std::regex_error const &)
+        {
+            error = std::current_exception();
+        }
+    }
+
+    /*!\brief Whether the whole `value` matches the pattern.
+     * \param[in]     value The string to match.
+     * \param[in,out] match The match results of `std::regex_match`; reused to avoid allocations when matching
+     *                      several strings.
+     * \throws std::regex_error if the pattern is not a valid regular expression.
+     */
+    bool matches(std::string const & value, std::smatch & match) const
+    {
+        if (automaton)
+            return automaton->matches(value);
+
+        if (error)
+            std::rethrow_exception(error);
+
+        return std::regex_match(value, match, *regex);
+    }
+
+    //!\brief Whether the pattern is matched by sharg::detail::regex_automaton.
+    bool uses_automaton() const noexcept
+    {
+        return automaton.has_value();
+    }
+
+private:
+    std::optional<regex_automaton> automaton{}; //!< The automaton, if it covers the pattern.
+    std::optional<std::regex> regex{};          //!< The std::regex, if the automaton does not cover the pattern.
+    std::exception_ptr error{};                 //!< The error of an invalid pattern.
+};
+
+} // namespace sharg::detail
@@ -4,13 +4,23 @@
 
 /*!\file
  * \author Svenja Mehringer <svenja.mehringer AT fu-berlin.de>
- * \brief Provides the concept sharg::detail::is_container_option.
+ * \brief Provides the concepts sharg::detail::is_container_option, sharg::detail::positional_sink,
+ *        sharg::detail::has_custom_from_chars, sharg::detail::is_duration, sharg::detail::non_owning_option,
+ *        sharg::detail::string_view_constructible_option and sharg::detail::string_pool_option.
  */
 
 #pragma once
 
+#include <chrono>
+#include <concepts>
+#include <iterator>
+#include <ranges>
 #include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
 
+#include <sharg/enumeration_names.hpp>
 #include <sharg/platform.hpp>
 
 namespace sharg::detail
@@ -43,4 +53,99 @@ concept is_container_option = (!std::is_same_v<std::remove_cvref_t<option_type>,
                               };
 // clang-format on
 
+/*!\concept sharg::detail::positional_sink
+ * \ingroup misc
+ * \brief Whether values of `value_type` can be passed to `sink_type` one at a time.
+ * \details
+ *
+ * A sink is either invocable with a `value_type` or an output iterator for `value_type`, e.g. a
+ * std::back_insert_iterator. See sharg::parser::add_positional_option_sink.
+ *
+ * \noapi
+ */
+template <typename sink_type, typename value_type>
+concept positional_sink = std::invocable<sink_type &, value_type> || std::output_iterator<sink_type, value_type>;
+
+/*!\concept sharg::detail::has_custom_from_chars
+ * \ingroup misc
+ * \brief Whether `sharg::custom::parsing<option_type>` provides a static member function `from_chars`.
+ * \details
+ *
+ * The function is called as `sharg::custom::parsing<option_type>::from_chars(std::string_view, option_type &)` and
+ * must return a `std::errc`. See sharg::custom::parsing.
+ *
+ * \noapi
+ */
+// clang-format off
+template <typename option_type>
+concept has_custom_from_chars = requires (std::string_view const in, option_type & value)
+                                {
+                                    { sharg::custom::parsing<option_type>::from_chars(in, value) }
+                                        -> std::same_as<std::errc>;
+                                };
+// clang-format on
+
+/*!\concept sharg::detail::is_duration
+ * \ingroup misc
+ * \brief Whether the option type is a std::chrono::duration.
+ * \details
+ *
+ * \noapi
+ */
+template <typename option_type>
+concept is_duration = std::same_as<option_type, std::chrono::duration<typename option_type::rep,
+                                                                      typename option_type::period>>;
+
+/*!\concept sharg::detail::non_owning_option
+ * \ingroup misc
+ * \brief Whether the option type refers to memory it does not own, e.g. std::string_view or std::span.
+ * \details
+ *
+ * A value of such a type would refer to the command line arguments stored by the parser, which are released when the
+ * parser is destroyed. Hence, these types are not sharg::parsable.
+ *
+ * \noapi
+ */
+template <typename option_type>
+concept non_owning_option = std::ranges::view<option_type> || std::ranges::borrowed_range<option_type>;
+
+/*!\concept sharg::detail::string_view_constructible_option
+ * \ingroup misc
+ * \brief Whether sharg::detail::value_parser constructs values of the option type directly from the argument.
+ * \details
+ *
+ * This applies to types like std::filesystem::path that are constructible from a std::string_view and are neither
+ * arithmetic, nor named enumerations, nor containers, nor sharg::detail::non_owning_option, and that do not
+ * customise sharg::custom::parsing::from_chars.
+ *
+ * \noapi
+ */
+template <typename option_type>
+concept string_view_constructible_option =
+    std::constructible_from<option_type, std::string_view> && !std::is_arithmetic_v<option_type>
+    && !named_enumeration<option_type> && !has_custom_from_chars<option_type> && !is_container_option<option_type>
+    && !non_owning_option<option_type>;
+
+/*!\concept sharg::detail::string_pool_option
+ * \ingroup misc
+ * \brief Whether the option type is a container of std::string_view that copies the characters of appended strings,
+ *        i.e. sharg::string_pool.
+ * \details
+ *
+ * The elements are not sharg::parsable themselves; sharg::detail::value_parser appends each argument with
+ * `push_back`, which stores a copy of its characters in the pool.
+ *
+ * \noapi
+ */
+// clang-format off
+template <typename option_type>
+concept string_pool_option = is_container_option<option_type>
+                          && std::same_as<std::ranges::range_value_t<option_type>, std::string_view>
+                          && requires (option_type & pool, std::string_view const in)
+                             {
+                                 { pool.push_back(in) };
+                                 { pool.reserve_characters(in.size()) };
+                             };
+// clang-format on
+
 } // namespace sharg::detail
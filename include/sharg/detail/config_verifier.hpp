@@ -0,0 +1,162 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \author Enrico Seiler <enrico.seiler AT fu-berlin.de>
+ * \brief Provides sharg::detail::config_verifier.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <string>
+
+#include <sharg/config.hpp>
+#include <sharg/detail/id_registry.hpp>
+#include <sharg/exceptions.hpp>
+
+namespace sharg::detail
+{
+
+/*!\brief Verifies the configurations of the options, flags and positional options added to a parser.
+ * \ingroup parser
+ *
+ * \details
+ *
+ * Used by sharg::parser and sharg::parser_schema, such that both accept the same configurations. Keeps track of the
+ * identifiers that are already used, including those of the special options, e.g. `--help`.
+ */
+class config_verifier
+{
+public:
+    /*!\brief Verifies the configuration of an option.
+     * \param[in] config  The configuration of the option.
+     * \param[in] is_list Whether the value of the option is a container.
+     * \throws sharg::design_error if the identifiers are invalid, the option is required and has a default message,
+     *         or the option has a list delimiter but is no container.
+     */
+    template <typename validator_t>
+    void verify_option_config(config<validator_t> const & config, bool const is_list)
+    {
+        verify_identifiers(config.short_id, config.long_id);
+
+        if (config.required && !config.default_message.empty())
+            throw design_error{"A required option cannot have a default message."};
+
+        if (config.list_delimiter != '\0' && !is_list)
+            throw design_error{"A list delimiter can only be set for options whose value is a container."};
+    }
+
+    /*!\brief Verifies the configuration of a flag.
+     * \throws sharg::design_error if the identifiers are invalid or the flag has a default message.
+     */
+    template <typename validator_t>
+    void verify_flag_config(config<validator_t> const & config)
+    {
+        verify_identifiers(config.short_id, config.long_id);
+
+        if (!config.default_message.empty())
+            throw design_error{"A flag may not have a default message because the default is always `false`."};
+
+        if (config.list_delimiter != '\0')
+            throw design_error{"A flag may not have a list delimiter."};
+    }
+
+    /*!\brief Verifies the configuration of a positional option.
+     * \param[in] config          The configuration of the positional option.
+     * \param[in] is_list         Whether the positional option takes all remaining arguments.
+     * \param[in] has_subcommands Whether the parser has subcommands.
+     * \throws sharg::design_error if the configuration is invalid or a positional list option was added before.
+     */
+    template <typename validator_t>
+    void verify_positional_option_config(config<validator_t> const & config,
+                                         bool const is_list,
+                                         bool const has_subcommands)
+    {
+        if (config.short_id != '\0' || config.long_id != "")
+            throw design_error{"Positional options are identified by their position on the command line. "
+                               "Short or long ids are not permitted!"};
+
+        if (config.advanced || config.hidden)
+            throw design_error{"Positional options are always required and therefore cannot be advanced nor hidden!"};
+
+        if (has_subcommands)
+            throw design_error{"You may only specify flags and options for the top-level parser."};
+
+        if (has_positional_list_option)
+            throw design_error{"You added a positional option with a list value before so you cannot add "
+                               "any other positional options."};
+
+        if (!config.default_message.empty())
+            throw design_error{"A positional option may not have a default message because it is always required."};
+
+        if (config.list_delimiter != '\0')
+            throw design_error{"A positional option may not have a list delimiter."};
+
+        has_positional_list_option = is_list; // keep track of a list option because there must be only one!
+    }
+
+    //!\brief The identifiers of all verified options and flags and of the special options.
+    id_registry const & used_ids() const noexcept
+    {
+        return used_option_ids;
+    }
+
+private:
+    //!\brief Keeps track of whether a positional list option was added to check if this was the very last.
+    bool has_positional_list_option{false};
+
+    //!\brief List of option/flag identifiers that are already used.
+    id_registry used_option_ids{{'h', "help"},
+                                {'\0' /*hh*/, "advanced-help"},
+                                {'\0', "hh"},
+                                {'\0', "export-help"},
+                                {'\0', "version"},
+                                {'\0', "copyright"}};
+
+    /*!\brief Verifies that the short and the long identifiers are correctly formatted.
+     * \param[in] short_id The short identifier of the command line option/flag.
+     * \param[in] long_id  The long identifier of the command line option/flag.
+     * \throws sharg::design_error
+     * \details Specifically, checks that identifiers haven't been used before,
+     *          the length of long IDs is either empty or longer than one char,
+     *          the characters used in the identifiers are all valid,
+     *          and at least one of short_id or long_id is given.
+     */
+    void verify_identifiers(char const short_id, std::string const & long_id)
+    {
+        auto is_valid = [](char const c) -> bool
+        {
+            return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') // alphanumeric
+                || c == '@' || c == '_' || c == '-';                                          // additional characters
+        };
+
+        if (short_id == '\0' && long_id.empty())
+            throw design_error{"Short and long identifiers may not both be empty."};
+
+        if (short_id != '\0')
+        {
+            if (short_id == '-' || !is_valid(short_id))
+                throw design_error{"Short identifiers may only contain alphanumeric characters, '_', or '@'."};
+            if (used_option_ids.contains(short_id))
+                throw design_error{"Short identifier '" + std::string(1, short_id) + "' was already used before."};
+        }
+
+        if (!long_id.empty())
+        {
+            if (long_id.size() == 1)
+                throw design_error{"Long identifiers must be either empty or longer than one character."};
+            if (long_id[0] == '-')
+                throw design_error{"Long identifiers may not use '-' as first character."};
+            if (!std::ranges::all_of(long_id, is_valid))
+                throw design_error{"Long identifiers may only contain alphanumeric characters, '_', '-', or '@'."};
+            if (used_option_ids.contains(long_id))
+                throw design_error{"Long identifier '" + long_id + "' was already used before."};
+        }
+
+        used_option_ids.emplace(short_id, long_id);
+    }
+};
+
+} // namespace sharg::detail
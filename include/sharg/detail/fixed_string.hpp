@@ -0,0 +1,45 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \author Enrico Seiler <enrico.seiler AT fu-berlin.de>
+ * \brief Provides sharg::detail::fixed_string.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <string_view>
+
+namespace sharg::detail
+{
+
+/*!\brief A string literal that can be used as template argument, e.g. the long identifier of a static option.
+ * \ingroup parser
+ * \tparam size The size of the literal, including the terminating null character.
+ */
+template <size_t size>
+struct fixed_string
+{
+    static_assert(size > 0u, "A fixed_string is constructed from a null-terminated string literal.");
+
+    //!\brief Constructs from a string literal.
+    constexpr fixed_string(char const (&literal)[size]) noexcept
+    {
+        std::ranges::copy_n(literal, size, characters.begin());
+    }
+
+    //!\brief The string without the terminating null character.
+    constexpr std::string_view view() const noexcept
+    {
+        return {characters.data(), size - 1u};
+    }
+
+    //!\brief The characters of the literal, including the terminating null character.
+    std::array<char, size> characters{};
+};
+
+} // namespace sharg::detail
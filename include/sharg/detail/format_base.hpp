@@ -67,6 +67,8 @@ protected:
             return verbose ? "char" : "char";
         else if constexpr (std::is_same_v<type, std::string>)
             return verbose ? "std::string" : "string";
+        else if constexpr (std::is_same_v<type, std::string_view>)
+            return verbose ? "std::string_view" : "string_view";
         else if constexpr (std::is_same_v<type, std::filesystem::path>)
             return verbose ? "std::filesystem::path" : "path";
         else if constexpr (!verbose && std::is_enum_v<type>)
@@ -195,7 +197,8 @@ protected:
      * \details
      * `value` is either `config.default_message`, or the same as `option`.
      * If the `option_type` is a std::string or std::filesystem::path, the value is quoted.
-     * If the `option_type` is a container of std::string or std::filesystem::path, each individual value is quoted;
+     * If the `option_type` is a container of strings, e.g. std::string, or of std::filesystem::path, each
+     * individual value is quoted;
      * if a `config.default_message` is provided, it will not be quoted.
      */
     template <typename option_type, typename default_type>
@@ -209,7 +212,7 @@ protected:
         if constexpr (detail::is_container_option<option_type>)
         {
             // If we have a list of strings, we want to quote each string.
-            if constexpr (std::same_as<std::ranges::range_value_t<default_type>, std::string>)
+            if constexpr (std::convertible_to<std::ranges::range_reference_t<default_type>, std::string_view>)
             {
                 auto view = std::views::transform(value,
                                                   [](auto const & val)
@@ -361,12 +364,7 @@ public:
         if (auto const & validator_message = config.validator.get_help_page_message(); !validator_message.empty())
             info += ". " + validator_message;
 
-        store_help_page_element(
-            [this, id, info]()
-            {
-                derived_t().print_list_item(id, info);
-            },
-            config);
+        store_help_page_element({help_page_element::kind::list_item, std::move(id), std::move(info)}, config);
 
         if (!(config.hidden) && (!(config.advanced) || show_advanced_options))
             store_synopsis_option(id_pair,
@@ -382,12 +380,8 @@ public:
     void add_flag(bool & SHARG_DOXYGEN_ONLY(value), config<validator_t> const & config)
     {
         detail::id_pair const id_pair{config.short_id, config.long_id};
-        store_help_page_element(
-            [this, id = prep_id_for_help(id_pair), description = config.description]()
-            {
-                derived_t().print_list_item(id, description);
-            },
-            config);
+        store_help_page_element({help_page_element::kind::list_item, prep_id_for_help(id_pair), config.description},
+                                config);
 
         // Store for synopsis generation
         if (!(config.hidden) && (!(config.advanced) || show_advanced_options))
@@ -422,20 +416,13 @@ public:
                 return {};
         };
 
-        positional_option_calls.push_back(
-            [this,
-             &value,
-             default_message = positional_default_message(),
-             validator_message = positional_validator_message(),
-             description = config.description]()
-            {
-                ++positional_option_count;
-                derived_t().print_list_item(detail::to_string("\\fBARGUMENT-",
-                                                              positional_option_count,
-                                                              "\\fP ",
-                                                              option_type_and_list_info(value)),
-                                            description + default_message + validator_message);
-            });
+        positional_option_elements.push_back(
+            {help_page_element::kind::list_item,
+             detail::to_string("\\fBARGUMENT-",
+                               positional_option_elements.size() + 1u,
+                               "\\fP ",
+                               option_type_and_list_info(value)),
+             config.description + positional_default_message() + positional_validator_message()});
 
         // Store for synopsis generation
         store_synopsis_positional(get_type_name_as_string<option_type, false>(),
@@ -486,19 +473,17 @@ public:
         }
 
         // add positional options if specified
-        if (!positional_option_calls.empty())
+        if (!positional_option_elements.empty())
             derived_t().print_section("Positional Arguments");
 
-        // each call will evaluate the function derived_t().print_list_item()
-        for (auto && f : positional_option_calls)
-            f();
+        for (help_page_element const & element : positional_option_elements)
+            print_help_page_element(element);
 
         // There are always options because of the common options
         derived_t().print_section("Options");
 
-        // each call will evaluate the function derived_t().print_list_item()
-        for (auto && f : parser_set_up_calls)
-            f();
+        for (help_page_element const & element : help_page_elements)
+            print_help_page_element(element);
 
         // print Common options after developer options
         derived_t().print_subsection("Common options");
@@ -528,60 +513,40 @@ public:
         derived_t().print_footer();
     }
 
-    /*!\brief Adds a print_section call to parser_set_up_calls.
+    /*!\brief Adds a section to help_page_elements.
      * \copydetails sharg::parser::add_section
      */
     void add_section(std::string const & title, bool const advanced_only)
     {
-        store_help_page_element(
-            [this, title]()
-            {
-                derived_t().print_section(title);
-            },
-            advanced_only,
-            false /* never hidden */);
+        store_help_page_element({help_page_element::kind::section, title}, advanced_only, false /* never hidden */);
     }
 
-    /*!\brief Adds a print_subsection call to parser_set_up_calls.
+    /*!\brief Adds a subsection to help_page_elements.
      * \copydetails sharg::parser::add_subsection
      */
     void add_subsection(std::string const & title, bool const advanced_only)
     {
-        store_help_page_element(
-            [this, title]()
-            {
-                derived_t().print_subsection(title);
-            },
-            advanced_only,
-            false /* never hidden */);
+        store_help_page_element({help_page_element::kind::subsection, title}, advanced_only, false /* never hidden */);
     }
 
-    /*!\brief Adds a print_line call to parser_set_up_calls.
+    /*!\brief Adds a line to help_page_elements.
      * \copydetails sharg::parser::add_line
      */
     void add_line(std::string const & text, bool is_paragraph, bool const advanced_only)
     {
-        store_help_page_element(
-            [this, text, is_paragraph]()
-            {
-                derived_t().print_line(text, is_paragraph);
-            },
-            advanced_only,
-            false /* never hidden */);
+        store_help_page_element({help_page_element::kind::line, text, {}, is_paragraph},
+                                advanced_only,
+                                false /* never hidden */);
     }
 
-    /*!\brief Adds a sharg::print_list_item call to parser_set_up_calls.
+    /*!\brief Adds a list item to help_page_elements.
      * \copydetails sharg::parser::add_list_item
      */
     void add_list_item(std::string const & key, std::string const & desc, bool const advanced_only)
     {
-        store_help_page_element(
-            [this, key, desc]()
-            {
-                derived_t().print_list_item(key, desc);
-            },
-            advanced_only,
-            false /* never hidden */);
+        store_help_page_element({help_page_element::kind::list_item, key, desc},
+                                advanced_only,
+                                false /* never hidden */);
     }
 
     /*!\brief Stores all meta information about the application
@@ -589,7 +554,7 @@ public:
      * \details
      *
      * This needs to be a member of format_parse, because it needs to present
-     * (not filled) when the parser_set_up_calls vector is filled, since all
+     * (not filled) when the help_page_elements vector is filled, since all
      * printing functions need some meta information.
      * The member variable itself is filled when copied over from the parser
      * when calling format_parse::parse. That way all the information needed are
@@ -756,12 +721,28 @@ protected:
         meta.synopsis.emplace_back(std::move(synopsis_line));
     }
 
-    //!\brief Vector of functions that stores all calls except add_positional_option.
-    std::vector<std::function<void()>> parser_set_up_calls;
-    //!\brief Vector of functions that stores add_positional_option calls.
-    std::vector<std::function<void()>> positional_option_calls; // singled out to be printed on top
-    //!\brief Keeps track of the number of positional options
-    unsigned positional_option_count{0};
+    //!\brief An element of the help page, e.g. a section or the list item describing an option.
+    struct help_page_element
+    {
+        //!\brief Kinds of help page elements.
+        enum class kind : uint8_t
+        {
+            section,    //!< Printed by print_section.
+            subsection, //!< Printed by print_subsection.
+            line,       //!< Printed by print_line.
+            list_item   //!< Printed by print_list_item.
+        };
+
+        kind type;                 //!< The kind of the element.
+        std::string text{};        //!< The title, line or key of the element.
+        std::string description{}; //!< The description of a list item.
+        bool is_paragraph{};       //!< Whether a line is a paragraph.
+    };
+
+    //!\brief Stores all help page elements except the positional options.
+    std::vector<help_page_element> help_page_elements;
+    //!\brief Stores the help page elements of the positional options.
+    std::vector<help_page_element> positional_option_elements; // singled out to be printed on top
     //!\brief The names of subcommand programs.
     std::vector<std::string> command_names{};
     //!\brief Whether to show advanced options or not.
@@ -784,8 +765,30 @@ protected:
     std::vector<synopsis_element> synopsis_elements{};
 
 private:
-    /*!\brief Adds a function object to parser_set_up_calls **if** the annotation in `config` does not prevent it.
-     * \param[in] printer The invokable that, if added to `parser_set_up_calls`, prints information to the help page.
+    /*!\brief Prints a help page element.
+     * \param[in] element The help page element to print.
+     */
+    void print_help_page_element(help_page_element const & element)
+    {
+        switch (element.type)
+        {
+            case help_page_element::kind::section:
+                derived_t().print_section(element.text);
+                break;
+            case help_page_element::kind::subsection:
+                derived_t().print_subsection(element.text);
+                break;
+            case help_page_element::kind::line:
+                derived_t().print_line(element.text, element.is_paragraph);
+                break;
+            case help_page_element::kind::list_item:
+                derived_t().print_list_item(element.text, element.description);
+                break;
+        }
+    }
+
+    /*!\brief Adds an element to help_page_elements **if** the annotation does not prevent it.
+     * \param[in] element The help page element.
      * \param[in] advanced Whether the help page element was configured to be hidden.
      * \param[in] hidden Whether the help page element was configured to be hidden.
      *
@@ -795,10 +798,10 @@ private:
      * If `advanced = true`, the information is only added to the help page if
      * the advanced help page has been queried on the command line (`show_advanced_options == true`).
      */
-    void store_help_page_element(std::function<void()> printer, bool const advanced, bool const hidden)
+    void store_help_page_element(help_page_element element, bool const advanced, bool const hidden)
     {
         if (!(hidden) && (!(advanced) || show_advanced_options))
-            parser_set_up_calls.push_back(std::move(printer));
+            help_page_elements.push_back(std::move(element));
     }
 
     /*!\brief Stores option information for synopsis generation.
@@ -857,8 +860,8 @@ private:
         synopsis_elements.push_back({std::move(pos_str), synopsis_element::option_type::positional});
     }
 
-    /*!\brief Adds a function object to parser_set_up_calls **if** the annotation in `config` does not prevent it.
-     * \param[in] printer The invokable that, if added to `parser_set_up_calls`, prints information to the help page.
+    /*!\brief Adds an element to help_page_elements **if** the annotation in `config` does not prevent it.
+     * \param[in] element The help page element.
      * \param[in] config The sharg::config object to access `config.advanced` and  `config.hidden`.
      *
      * \details
@@ -868,10 +871,10 @@ private:
      * the advanced help page has been queried on the command line (`show_advanced_options == true`).
      */
     template <typename validator_t>
-    void store_help_page_element(std::function<void()> printer, config<validator_t> const & config)
+    void store_help_page_element(help_page_element element, config<validator_t> const & config)
     {
         if (!(config.hidden) && (!(config.advanced) || show_advanced_options))
-            parser_set_up_calls.push_back(std::move(printer));
+            help_page_elements.push_back(std::move(element));
     }
 };
 
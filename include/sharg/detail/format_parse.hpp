@@ -9,15 +9,36 @@
 
 #pragma once
 
-#include <sharg/std/charconv>
+#include <cassert>
+#include <functional>
+#include <memory>
+#include <span>
+#include <string_view>
 
-#include <sharg/concept.hpp>
-#include <sharg/detail/format_base.hpp>
 #include <sharg/detail/id_pair.hpp>
+#include <sharg/detail/id_registry.hpp>
+#include <sharg/detail/probe.hpp>
+#include <sharg/detail/trace.hpp>
+#include <sharg/detail/value_parser.hpp>
 
 namespace sharg::detail
 {
 
+/*!\brief An option, flag or positional option whose value is stored in a member of the object being parsed into.
+ * \ingroup parser
+ * \tparam object_type The type of the object, e.g. the options of an application.
+ * \tparam value_type  The type of the member.
+ * \tparam validator_t The type of the validator.
+ * \details
+ * Used by sharg::parser_schema, whose options are not bound to variables but to members of the result of a parse.
+ */
+template <typename object_type, typename value_type, typename validator_t>
+struct member_binding
+{
+    value_type object_type::* member;  //!< The member that stores the value.
+    config<validator_t> configuration; //!< The configuration of the option.
+};
+
 /*!\brief The format that organizes the actual parsing of command line arguments.
  * \ingroup parser
  *
@@ -27,54 +48,102 @@ namespace sharg::detail
  * parameters/options/flags/.. directly (though a variant might work, it is hacky).
  * Directly parsing is also difficult, since the order of parsing options/flags
  * is non trivial (e.g. ambiguousness of '-g 4' => option+value or flag+positional).
- * Therefore, we store the parsing calls of the developer in a function object,
- * (format_parse::option_and_flag_calls, sharg::detail::format_parse::positional_option_calls)
+ * Therefore, we store the parsing calls of the developer as function pointers to the respective typed function
+ * (format_parse::definition_type::option_calls, format_parse::definition_type::flag_calls,
+ * format_parse::definition_type::positional_option_calls)
  * executing them in a new order when calling format_parse::parse().
  * This enables us to parse any option type and resolve any ambiguousness, so no
  * additional restrictions apply to the developer when setting up the parser.
  *
- * Order of parsing:
+ * When adding an option or flag, its identifiers are registered in format_parse::definition_type::registered_ids.
+ * On parse(), the command line arguments are tokenized in a single pass (value_parser::tokenize): Each argument is
+ * classified exactly once and the values of known options are recorded for the respective option. Hence, the cost of
+ * parsing is linear in the number of arguments and independent of the number of registered options.
+ *
+ * For each option and flag, the positions of the arguments that specify it are recorded in format_parse::id_positions.
+ * Hence, whether and how often an option was given can be queried in constant time after parsing
+ * (format_parse::positions).
+ *
+ * Order of evaluation:
  * -#. Options            (order within as specified by the developer)
  * -#. Flags              (order within as specified by the developer)
  * -#. Positional Options (order within as specified by the developer)
  *
- * When parsing flags and options, the identifiers (and values) are removed from
- * the vector format_parse::arguments. That way, options that are specified multiple times,
- * but are no container type, can be identified and an error is reported.
+ * Options that are specified multiple times, but are no container type, are identified by their recorded
+ * occurrences and an error is reported.
+ *
+ * The registered options (format_parse::definition_type) are not modified by parsing. A format that is constructed
+ * from a prototype shares the registered options of the prototype and only holds the state of a single parse. This
+ * allows sharg::parser_schema to parse concurrently without registering the options again.
  *
  * \remark For a complete overview, take a look at \ref parser
  */
-class format_parse : public format_base
+class format_parse : public value_parser
 {
 public:
     /*!\name Constructors, destructor and assignment
      * \{
      */
-    format_parse() = delete;                                     //!< Deleted.
-    format_parse(format_parse const & pf) = default;             //!< Defaulted.
-    format_parse & operator=(format_parse const & pf) = default; //!< Defaulted.
-    format_parse(format_parse &&) = default;                     //!< Defaulted.
-    format_parse & operator=(format_parse &&) = default;         //!< Defaulted.
-    ~format_parse() = default;                                   //!< Defaulted.
+    format_parse() = delete;                                 //!< Deleted.
+    format_parse(format_parse const &) = delete;             //!< Deleted.
+    format_parse & operator=(format_parse const &) = delete; //!< Deleted.
+    format_parse(format_parse &&) = default;                 //!< Defaulted.
+    format_parse & operator=(format_parse &&) = default;     //!< Defaulted.
+    ~format_parse() = default;                               //!< Defaulted.
 
     /*!\brief The constructor of the parse format.
-     * \param[in] cmd_arguments The command line arguments to parse.
+     * \param[in] cmd_arguments The command line arguments to parse; not copied, i.e. must outlive the format.
+     * \param[in] cmd_positions The position of each argument on the original command line; not copied. If empty, the
+     *                          positions in `cmd_arguments` are recorded.
+     */
+    format_parse(std::span<std::string_view const> cmd_arguments, std::span<size_t const> cmd_positions = {}) :
+        owned_definition{std::make_unique<definition_type>()},
+        definition{owned_definition.get()},
+        arguments{cmd_arguments},
+        argument_positions{cmd_positions}
+    {
+        assert(argument_positions.empty() || argument_positions.size() == arguments.size());
+    }
+
+    /*!\brief Constructs a format that parses into `target` using the options added to `prototype`.
+     * \param[in] prototype     The format the options were added to; not copied, i.e. must outlive the format.
+     * \param[in] cmd_arguments The command line arguments to parse; not copied, i.e. must outlive the format.
+     * \param[in] target        The object whose members the options are bound to; see sharg::detail::member_binding.
+     * \details
+     * The prototype is not modified. Hence, formats constructed from the same prototype may parse concurrently.
+     * Options must not be added to the constructed format.
      */
-    format_parse(std::vector<std::string> cmd_arguments) : arguments{std::move(cmd_arguments)}
+    format_parse(format_parse const & prototype, std::span<std::string_view const> cmd_arguments, void * const target) :
+        definition{prototype.definition},
+        arguments{cmd_arguments},
+        target{target},
+        option_occurrences(definition->option_calls.size()),
+        id_positions(definition->id_entries.size())
     {}
     //!\}
 
     /*!\brief Adds an sharg::detail::get_option call to be evaluated later on.
      * \copydetails sharg::parser::add_option
+     *
+     * The `config` is not copied, i.e. it must outlive the format. The sharg::parser stores it in its
+     * sharg::detail::option_table.
      */
     template <typename option_type, typename validator_t>
     void add_option(option_type & value, config<validator_t> const & config)
     {
-        option_calls.push_back(
-            [this, &value, config]()
-            {
-                get_option(value, config);
-            });
+        add_option_call(&call_get_option<option_type, validator_t>, &value, &config, config);
+    }
+
+    /*!\brief Adds an option whose value is stored in a member of the target.
+     * \param[in] binding The member and configuration of the option; not copied, i.e. must outlive the format.
+     */
+    template <typename object_type, typename option_type, typename validator_t>
+    void add_option(member_binding<object_type, option_type, validator_t> const & binding)
+    {
+        add_option_call(&call_get_member_option<object_type, option_type, validator_t>,
+                        nullptr,
+                        &binding,
+                        binding.configuration);
     }
 
     /*!\brief Adds a get_flag call to be evaluated later on.
@@ -83,48 +152,86 @@ public:
     template <typename validator_t>
     void add_flag(bool & value, config<validator_t> const & config)
     {
-        flag_calls.push_back(
-            [this, &value, config]()
-            {
-                get_flag(value, config.short_id, config.long_id);
-            });
+        add_flag_call(&call_get_flag, &value, nullptr, config);
+    }
+
+    /*!\brief Adds a flag whose value is stored in a member of the target.
+     * \param[in] binding The member and configuration of the flag; not copied, i.e. must outlive the format.
+     */
+    template <typename object_type, typename validator_t>
+    void add_flag(member_binding<object_type, bool, validator_t> const & binding)
+    {
+        add_flag_call(&call_get_member_flag<object_type, validator_t>, nullptr, &binding, binding.configuration);
     }
 
     /*!\brief Adds a get_positional_option call to be evaluated later on.
      * \copydetails sharg::parser::add_positional_option
+     *
+     * The `config` is not copied, i.e. it must outlive the format. The sharg::parser stores it in its
+     * sharg::detail::option_table.
      */
     template <typename option_type, typename validator_t>
     void add_positional_option(option_type & value, config<validator_t> const & config)
     {
-        positional_option_calls.push_back(
-            [this, &value, config]()
-            {
-                get_positional_option(value, config.validator);
-            });
+        assert(owned_definition);
+        owned_definition->positional_option_calls.push_back(
+            parse_call{&call_get_positional_option<option_type, validator_t>, &value, &config, 0u});
+    }
+
+    /*!\brief Adds a positional option whose value is stored in a member of the target.
+     * \param[in] binding The member and configuration of the option; not copied, i.e. must outlive the format.
+     */
+    template <typename object_type, typename option_type, typename validator_t>
+    void add_positional_option(member_binding<object_type, option_type, validator_t> const & binding)
+    {
+        assert(owned_definition);
+        owned_definition->positional_option_calls.push_back(
+            parse_call{&call_get_member_positional_option<object_type, option_type, validator_t>,
+                       nullptr,
+                       &binding,
+                       0u});
+    }
+
+    /*!\brief Adds a get_positional_option_sink call to be evaluated later on.
+     * \copydetails sharg::parser::add_positional_option_sink
+     *
+     * Neither the `sink` nor the `config` are copied, i.e. they must outlive the format. The sharg::parser stores
+     * them in its sharg::detail::option_table.
+     */
+    template <typename value_type, typename sink_type, typename validator_t>
+    void add_positional_option_sink(sink_type & sink, config<validator_t> const & config)
+    {
+        assert(owned_definition);
+        owned_definition->positional_option_calls.push_back(
+            parse_call{&call_get_positional_option_sink<value_type, sink_type, validator_t>, &sink, &config, 0u});
     }
 
     //!\brief Initiates the actual command line parsing.
     void parse(parser_meta_data const & /*meta*/, std::vector<std::string> const & /*executable_name*/)
     {
-        end_of_options_it = std::find(arguments.begin(), arguments.end(), "--");
+        parse();
+    }
+
+    //!\overload
+    void parse()
+    {
+        // classify every argument exactly once
+        tokenize(arguments, tokenize_handler{*this}, positionals, unknown_id);
 
         // parse options first, because we need to rule out -keyValue pairs
         // (e.g. -AnoSpaceAfterIdentifierA) before parsing flags
-        for (auto && f : option_calls)
-            f();
-
-        for (auto && f : flag_calls)
-            f();
+        for (parse_call const & call : definition->option_calls)
+            call.get(*this, call);
 
-        check_for_unknown_ids();
+        for (parse_call const & call : definition->flag_calls)
+            call.get(*this, call);
 
-        if (end_of_options_it != arguments.end())
-            *end_of_options_it = ""; // remove -- before parsing positional arguments
+        check_for_unknown_ids(unknown_id);
 
-        for (auto && f : positional_option_calls)
-            f();
+        for (parse_call const & call : definition->positional_option_calls)
+            call.get(*this, call);
 
-        check_for_left_over_args();
+        check_for_left_over_args(positionals);
     }
 
     // functions are not needed for command line parsing but are part of the format help interface.
@@ -139,674 +246,324 @@ public:
     {}
     //!\endcond
 
-    /*!\brief Finds the position of a short/long identifier in format_parse::arguments.
-     * \tparam iterator_type The type of iterator that defines the range to search in.
-     * \tparam id_type The identifier type; must be either of type `char` if it denotes a short identifier or
-     *                 std::string if it denotes a long identifier.
-     * \param[in] begin_it The iterator where to start the search of the identifier.
-     * \param[in] end_it The iterator one past the end of where to search the identifier.
-     * \param[in] id The identifier to search for (must not contain dashes).
-     * \returns An iterator pointing to the first occurrence of `id` in the list pointed to by `begin_it`
-     *          or `end_it` if it is not contained.
+    /*!\brief Returns the positions of the arguments that specified an option or flag, in command line order.
+     * \param[in] id The short or long identifier of the option or flag.
+     * \returns The positions on the command line; empty if the option or flag was not given or is not known.
      *
      * \details
      *
-     * **Valid short-id value pairs are: `-iValue`, `-i=Value`, or `-i Value`**
-     * If the `id` passed to this function is of type `char`, it is assumed to be a short identifier.
-     * The `id` is found by comparing the prefix of every argument in arguments to the `id` prepended with a single `-`.
-     *
-     * **Valid long id value pairs are: `--id=Value`, `--id Value`**.
-     * If the `id` passed to this function is of type `std::string`, it is assumed to be a long identifier.
-     * The `id` is found by comparing every argument in arguments to `id` prepended with two dashes (`--`)
-     * or a prefix of such followed by the equal sign `=`.
+     * The positions refer to the `cmd_positions` passed on construction or, if none were passed, to the arguments of
+     * the format, and denote the arguments containing the identifier, e.g. `-i` for `-i 1` or `-vi1` for `-vi1`.
+     * An option given more than once has one position per occurrence. Arguments after \-- are never identifiers.
+     * The lookup is done in constant time. The result is only meaningful after format_parse::parse was called.
      */
-    template <typename iterator_type>
-    static iterator_type find_option_id(iterator_type begin_it, iterator_type end_it, detail::id_pair const & id)
+    std::span<size_t const> positions(id_pair const & id) const
     {
-        bool const short_id_empty{id.empty_short_id()};
-        bool const long_id_empty{id.empty_long_id()};
-
-        if (short_id_empty && long_id_empty)
-            return end_it;
-
-        std::string const short_id = prepend_dash(id.short_id);
-        std::string const long_id_equals = prepend_dash(id.long_id) + "=";
-        std::string_view const long_id_space = [&long_id_equals]()
-        {
-            std::string_view tmp{long_id_equals};
-            tmp.remove_suffix(1u);
-            return tmp;
-        }();
-
-        auto cmp = [&](std::string_view const current_arg)
-        {
-            // check if current_arg starts with "-o", i.e. it correctly identifies all short notations:
-            // "-ovalue", "-o=value", and "-o value".
-            if (!short_id_empty && current_arg.starts_with(short_id))
-                return true;
-
-            // only "--opt Value" or "--opt=Value" are valid
-            if (!long_id_empty && (current_arg == long_id_space || current_arg.starts_with(long_id_equals)))
-                return true;
-
-            return false;
-        };
-
-        return std::find_if(begin_it, end_it, cmp);
+        size_t const position = definition->registered_ids.find(id);
+        return (position == id_registry::npos) ? std::span<size_t const>{} : std::span{id_positions[position]};
     }
 
 private:
-    //!\brief Describes the result of parsing the user input string given the respective option value type.
-    enum class option_parse_result : uint8_t
+    /*!\brief A deferred call to get_option, get_flag, get_positional_option or get_positional_option_sink.
+     * \details
+     * The function pointer is instantiated for the respective option and validator type, so no type erasure
+     * with dynamic memory is needed.
+     */
+    struct parse_call
     {
-        success,       //!< Parsing of user input was successful.
-        error,         //!< There was some error while trying to parse the user input.
-        overflow_error //!< Parsing was successful but the arithmetic value would cause an overflow.
+        //!\brief Retrieves the value of the option, flag or positional option.
+        void (*get)(format_parse &, parse_call const &);
+        void * value;        //!< The variable of the option, flag or positional option, or the sink.
+        void const * config; //!< The sharg::config of the option or positional option; `nullptr` for flags.
+        size_t index;        //!< The position in format_parse::option_occurrences or format_parse::id_positions.
     };
 
-    /*!\brief Appends a double dash to a long identifier and returns it.
-    * \param[in] long_id The name of the long identifier.
-    * \returns The input long name prepended with a double dash.
-    */
-    static std::string prepend_dash(std::string const & long_id)
+    //!\brief The iterator over format_parse::arguments.
+    using argument_iterator = std::span<std::string_view const>::iterator;
+
+    //!\brief Refers to the option or flag that a registered identifier belongs to.
+    struct id_entry
     {
-        return {"--" + long_id};
-    }
+        id_kind kind{id_kind::none}; //!< Whether the identifier belongs to an option or a flag.
+        size_t index{};              //!< The position in format_parse::option_occurrences; `position` for flags.
+        size_t position{};           //!< The position in the registry and in format_parse::id_positions.
+    };
 
-    /*!\brief Appends a double dash to a short identifier and returns it.
-    * \param[in] short_id The name of the short identifier.
-    * \returns The input short name prepended with a single dash.
-    */
-    static std::string prepend_dash(char const short_id)
+    //!\brief The registered options, flags and positional options; not modified by parsing.
+    struct definition_type
     {
-        return {'-', short_id};
-    }
+        //!\brief Stores get_option calls to be evaluated when calling format_parse::parse().
+        std::vector<parse_call> option_calls{};
+        //!\brief Stores get_flag calls to be evaluated when calling format_parse::parse().
+        std::vector<parse_call> flag_calls{};
+        //!\brief Stores get_positional_option calls to be evaluated when calling format_parse::parse().
+        std::vector<parse_call> positional_option_calls{};
+        //!\brief The identifiers of all options and flags.
+        id_registry registered_ids{};
+        //!\brief The option or flag that the identifiers at the same position in registered_ids belong to.
+        std::vector<id_entry> id_entries{};
+    };
 
-    /*!\brief Returns "-[short_id]/--[long_id]" if both are non-empty or just one of them if the other is empty.
-    * \param[in] short_id The name of the short identifier.
-    * \param[in] long_id  The name of the long identifier.
-    * \returns The short_id prepended with a single dash and the long_id prepended with a double dash, separated by '/'.
-    */
-    std::string combine_option_names(char const short_id, std::string const & long_id)
+    /*!\brief Makes the identifiers of an option or flag known to value_parser::tokenize.
+     * \param[in] short_id The short identifier; not registered if empty.
+     * \param[in] long_id  The long identifier; not registered if empty.
+     * \param[in] entry    The option or flag the identifiers belong to.
+     */
+    void register_ids(char const short_id, std::string const & long_id, id_entry entry)
     {
-        if (short_id == '\0')
-            return prepend_dash(long_id);
-        else if (long_id.empty())
-            return prepend_dash(short_id);
-        else // both are set (note: both cannot be empty, this is caught before)
-            return prepend_dash(short_id) + "/" + prepend_dash(long_id);
+        assert(owned_definition);
+        entry.position = owned_definition->id_entries.size();
+        owned_definition->registered_ids.emplace(short_id, long_id);
+        owned_definition->id_entries.push_back(entry);
+        id_positions.emplace_back();
     }
 
-    /*!\brief Returns true and removes the long identifier if it is in format_parse::arguments.
-     * \param[in] long_id The long identifier of the flag to check.
+    /*!\brief Registers an option and adds its parse_call.
+     * \param[in] get    The function retrieving the value of the option.
+     * \param[in] value  The variable of the option; `nullptr` for a sharg::detail::member_binding.
+     * \param[in] data   The configuration of the option or the sharg::detail::member_binding.
+     * \param[in] config The configuration of the option.
      */
-    bool flag_is_set(std::string const & long_id)
+    template <typename validator_t>
+    void add_option_call(void (*get)(format_parse &, parse_call const &),
+                         void * const value,
+                         void const * const data,
+                         config<validator_t> const & config)
     {
-        auto it = std::find(arguments.begin(), end_of_options_it, prepend_dash(long_id));
-
-        if (it != end_of_options_it)
-            *it = ""; // remove seen flag
+        size_t const option_index = option_occurrences.size();
+        option_occurrences.emplace_back();
+        register_ids(config.short_id, config.long_id, id_entry{id_kind::option, option_index});
 
-        return (it != end_of_options_it);
+        owned_definition->option_calls.push_back(parse_call{get, value, data, option_index});
     }
 
-    /*!\brief Returns true and removes the short identifier if it is in format_parse::arguments.
-     * \param[in] short_id The short identifier of the flag to check.
+    /*!\brief Registers a flag and adds its parse_call.
+     * \param[in] get    The function retrieving the value of the flag.
+     * \param[in] value  The variable of the flag; `nullptr` for a sharg::detail::member_binding.
+     * \param[in] data   `nullptr` or the sharg::detail::member_binding.
+     * \param[in] config The configuration of the flag.
      */
-    bool flag_is_set(char const short_id)
+    template <typename validator_t>
+    void add_flag_call(void (*get)(format_parse &, parse_call const &),
+                       void * const value,
+                       void const * const data,
+                       config<validator_t> const & config)
     {
-        // short flags need special attention, since they could be grouped (-rGv <=> -r -G -v)
-        for (std::string & arg : arguments)
-        {
-            if (arg[0] == '-' && arg.size() > 1 && arg[1] != '-') // is option && not dash && no long option
-            {
-                auto pos = arg.find(short_id);
-
-                if (pos != std::string::npos)
-                {
-                    arg.erase(pos, 1); // remove seen bool
-
-                    if (arg == "-") // if flag is empty now
-                        arg = "";
+        size_t const flag_position = id_positions.size();
+        register_ids(config.short_id, config.long_id, id_entry{id_kind::flag, flag_position});
 
-                    return true;
-                }
-            }
-        }
-        return false;
+        owned_definition->flag_calls.push_back(parse_call{get, value, data, flag_position});
     }
 
-    /*!\brief Tries to parse an input string into a value using the stream `operator>>`.
-     * \tparam option_t Must model sharg::istreamable.
-     * \param[out] value Stores the parsed value.
-     * \param[in] in The input argument to be parsed.
-     * \returns sharg::option_parse_result::error if `in` could not be parsed via the stream
-     *          operator and otherwise sharg::option_parse_result::success.
+    /*!\brief Returns the option or flag that an identifier belongs to.
+     * \param[in] id The short or long identifier (without dashes).
+     * \returns The respective entry or an entry of kind id_kind::none if the identifier is not known.
      */
-    template <typename option_t>
-        requires istreamable<option_t>
-    option_parse_result parse_option_value(option_t & value, std::string const & in)
+    template <typename id_type>
+    id_entry find_id(id_type const id) const
     {
-        std::istringstream stream{in};
-        stream >> value;
-
-        if (stream.fail() || !stream.eof())
-            return option_parse_result::error;
-
-        return option_parse_result::success;
+        size_t const position = definition->registered_ids.find(id);
+        return (position == id_registry::npos) ? id_entry{} : definition->id_entries[position];
     }
 
-    /*!\brief Sets an option value depending on the keys found in sharg::enumeration_names<option_t>.
-     * \tparam option_t Must model sharg::named_enumeration.
-     * \param[out] value Stores the parsed value.
-     * \param[in] in The input argument to be parsed.
-     * \throws sharg::user_input_error if `in` is not a key in sharg::enumeration_names<option_t>.
-     * \returns sharg::option_parse_result::success.
+    /*!\brief Looks up the identifiers and records the options and flags for value_parser::tokenize.
+     * \details
+     * The values of options are recorded in format_parse::option_occurrences. The positions of the arguments
+     * specifying an option or flag are recorded in format_parse::id_positions.
      */
-    template <named_enumeration option_t>
-    option_parse_result parse_option_value(option_t & value, std::string const & in)
+    struct tokenize_handler
     {
-        auto map = sharg::enumeration_names<option_t>;
+        format_parse & format; //!< The format.
 
-        if (auto it = map.find(in); it == map.end())
+        //!\brief Returns the option or flag that an identifier belongs to; see format_parse::find_id.
+        template <typename id_type>
+        id_entry find_id(id_type const id) const
         {
-            std::string keys = [&map]()
-            {
-                std::vector<std::pair<std::string_view, option_t>> key_value_pairs(map.begin(), map.end());
-
-                std::sort(key_value_pairs.begin(),
-                          key_value_pairs.end(),
-                          [](auto pair1, auto pair2)
-                          {
-                              if constexpr (std::totally_ordered<option_t>)
-                              {
-                                  if (pair1.second != pair2.second)
-                                      return pair1.second < pair2.second;
-                              }
-
-                              return pair1.first < pair2.first;
-                          }); // needed for deterministic output when using unordered maps
-
-                std::string result{'['};
-                for (auto const & [key, value] : key_value_pairs)
-                    result += std::string{key} + ", ";
-                result.replace(result.size() - 2, 2, "]"); // replace last ", " by "]"
-                return result;
-            }();
-
-            throw user_input_error{"You have chosen an invalid input value: " + in + ". Please use one of: " + keys};
+            return format.find_id(id);
         }
-        else
+
+        //!\brief Records the value of the option of `entry` given in the argument at `arg_it`.
+        void record_option(id_entry const entry, argument_iterator const arg_it, option_occurrence const occurrence)
         {
-            value = it->second;
+            SHARG_PROBE3(option_match, entry.index, arg_it->data(), arg_it->size());
+            record_position(entry, arg_it);
+            format.option_occurrences[entry.index].push_back(occurrence);
         }
 
-        return option_parse_result::success;
-    }
+        //!\brief Records the flag of `entry` given in the argument at `arg_it`; `false` if it was already given.
+        bool record_flag(id_entry const entry, argument_iterator const arg_it)
+        {
+            if (!format.id_positions[entry.position].empty())
+                return false;
 
-    //!\cond
-    option_parse_result parse_option_value(std::string & value, std::string const & in)
-    {
-        value = in;
-        return option_parse_result::success;
-    }
-    //!\endcond
+            record_position(entry, arg_it);
+            return true;
+        }
 
-    /*!\brief Parses the given option value and appends it to the target container.
-     * \tparam container_option_t Must model sharg::detail::is_container_option and
-     *                            its value_type must be parseable via parse_option_value
-     * \tparam format_parse_t Needed to make the function "dependent" (i.e. do instantiation in the second phase of
-     *                        two-phase lookup) as the requires clause needs to be able to access the other
-     *                        parse_option_value overloads.
-     *
-     * \param[out] value The container that stores the parsed value.
-     * \param[in] in The input argument to be parsed.
-     * \returns A sharg::option_parse_result whether parsing was successful or not.
-     */
-    // clang-format off
-    template <detail::is_container_option container_option_t, typename format_parse_t = format_parse>
-        requires requires (format_parse_t fp,
-                           typename container_option_t::value_type & container_value,
-                           std::string const & in)
+        //!\brief Records that the option or flag of `entry` was given in the argument at `arg_it`.
+        void record_position(id_entry const entry, argument_iterator const arg_it)
         {
-            {fp.parse_option_value(container_value, in)} -> std::same_as<option_parse_result>;
+            size_t const index = static_cast<size_t>(arg_it - format.arguments.begin());
+            format.id_positions[entry.position].push_back(
+                format.argument_positions.empty() ? index : format.argument_positions[index]);
         }
-    // clang-format on
-    option_parse_result parse_option_value(container_option_t & value, std::string const & in)
-    {
-        typename container_option_t::value_type tmp{};
-
-        auto res = parse_option_value(tmp, in);
-
-        if (res == option_parse_result::success)
-            value.push_back(tmp);
-
-        return res;
-    }
+    };
 
-    /*!\brief Tries to parse an input string into an arithmetic value.
-     * \tparam option_t The option value type; must model std::is_arithmetic_v.
-     * \param[out] value Stores the parsed value.
-     * \param[in] in The input argument to be parsed.
-     * \returns sharg::option_parse_result::error if `in` could not be parsed to an arithmetic type
-     *          via std::from_chars, sharg::option_parse_result::overflow_error if `in` could be parsed but the
-     *          value is too large for the respective type, and otherwise sharg::option_parse_result::success.
-     *
-     * \details
+    /*!\brief Handles command line flags, whether they are set or not.
      *
-     * This function delegates to std::from_chars.
+     * \param[out] value      The variable which shows if the flag is turned off (default) or on.
+     * \param[in]  flag_index The position of the flag in format_parse::id_positions.
      */
-    template <typename option_t>
-        requires std::is_arithmetic_v<option_t> && istreamable<option_t>
-    option_parse_result parse_option_value(option_t & value, std::string const & in)
+    void get_flag(bool & value, size_t const flag_index)
     {
-        auto res = std::from_chars(in.data(), in.data() + in.size(), value);
-
-        if (res.ec == std::errc::result_out_of_range)
-            return option_parse_result::overflow_error;
-        else if (res.ec == std::errc::invalid_argument || res.ptr != in.data() + in.size())
-            return option_parse_result::error;
-
-        return option_parse_result::success;
+        // `|| value` is needed to keep the value if it was set before.
+        value = !id_positions[flag_index].empty() || value;
     }
 
-    /*!\brief Tries to parse an input string into a boolean value.
-     * \param[out] value Stores the parsed value.
-     * \param[in] in The input argument to be parsed.
-     * \returns A sharg::option_parse_result whether parsing was successful or not.
+    /*!\brief Parses each remaining positional argument and passes it to a sink.
+     *
+     * \tparam value_type The type of a single value.
+     * \param[in,out] sink      The sink that receives each value; see sharg::detail::positional_sink.
+     * \param[in]     validator The validator applied to each value after parsing (callable).
+     *
+     * \throws sharg::too_few_arguments
+     * \throws sharg::user_input_error
+     * \throws sharg::validation_error
      *
      * \details
      *
-     * This function accepts the strings "0" or "false" which sets sets `value` to `false` or "1" or "true" which
-     * sets `value` to `true`.
+     * In contrast to get_positional_option with a container type, the values are not stored. Each value is parsed,
+     * validated and passed to the sink before the next argument is parsed. If an argument is invalid, the sink has
+     * received all values before it.
      */
-    option_parse_result parse_option_value(bool & value, std::string const & in)
+    template <typename value_type, typename sink_type, typename validator_type>
+    void get_positional_option_sink(sink_type & sink, validator_type && validator)
     {
-        if (in == "0" || in == "false")
-            value = false;
-        else if (in == "1" || in == "true")
-            value = true;
-        else
-            return option_parse_result::error;
-
-        return option_parse_result::success;
-    }
+        ++positionals.option_number;
 
-    /*!\brief Tries to parse an input string into boolean value.
-     * \param[in] res A result value of parsing an input string to the respective option value type.
-     * \param[in] option_name The name of the option whose input was parsed.
-     * \param[in] input_value The original user input in question.
-     *
-     * \throws sharg::user_input_error if `res` was not sharg::option_parse_result::success.
-     */
-    template <typename option_type>
-    void throw_on_input_error(option_parse_result const res,
-                              std::string const & option_name,
-                              std::string const & input_value)
-    {
-        std::string msg{"Value parse failed for " + option_name + ": "};
+        if (positionals.next_argument == positionals.arguments.size())
+            throw too_few_arguments("Not enough positional arguments provided (Need at least "
+                                    + std::to_string(definition->positional_option_calls.size())
+                                    + "). See -h/--help for more information.");
 
-        if (res == option_parse_result::error)
-        {
-            throw user_input_error{msg + "Argument " + input_value + " could not be parsed as type "
-                                   + get_type_name_as_string<option_type>() + "."};
-        }
+        assert(positionals.option_number == definition->positional_option_calls.size()); // checked on set up.
 
-        if constexpr (std::is_arithmetic_v<option_type>)
+        for (; positionals.next_argument < positionals.arguments.size();
+             ++positionals.next_argument, ++positionals.option_number)
         {
-            if (res == option_parse_result::overflow_error)
-            {
-                throw user_input_error{msg + "Numeric argument " + input_value + " is not in the valid range ["
-                                       + std::to_string(std::numeric_limits<option_type>::min()) + ","
-                                       + std::to_string(std::numeric_limits<option_type>::max()) + "]."};
-            }
-        }
+            std::string_view const arg = positionals.arguments[positionals.next_argument];
+            value_type value{};
 
-        assert(res == option_parse_result::success); // if nothing was thrown, the result must have been a success
-    }
+            if (auto res = parse_option_value(value, arg); res != option_parse_result::success)
+                throw_on_input_error<value_type>(res,
+                                                 "positional option" + std::to_string(positionals.option_number),
+                                                 arg);
 
-    /*!\brief Handles value retrieval for options based on different key-value pairs.
-     *
-     * \param[out] value     Stores the value found in arguments, parsed by parse_option_value.
-     * \param[in]  option_it The iterator where the option identifier was found.
-     * \param[in]  id        The option identifier supplied on the command line.
-     *
-     * \throws sharg::too_few_arguments if the option was not followed by a value.
-     * \throws sharg::user_input_error if the given option value was invalid.
-     *
-     * \details
-     *
-     * The value at option_it is inspected whether it is an '-key value', '-key=value'
-     * or '-keyValue' pair and the input is extracted accordingly. The input
-     * will then be tried to be parsed into the `value` parameter.
-     *
-     * Returns true on success and false otherwise.
-     */
-    template <typename option_type, typename id_type>
-    bool identify_and_retrieve_option_value(option_type & value,
-                                            std::vector<std::string>::iterator & option_it,
-                                            id_type const & id)
-    {
-        if (option_it != end_of_options_it)
-        {
-            std::string input_value;
-            size_t id_size = (prepend_dash(id)).size();
+            positional_label_buffer buffer;
+            std::string_view const label = trace_label(buffer, positionals.option_number);
 
-            if ((*option_it).size() > id_size) // identifier includes value (-keyValue or -key=value)
+            try
             {
-                if ((*option_it)[id_size] == '=') // -key=value
-                {
-                    if ((*option_it).size() == id_size + 1) // malformed because no value follows '-i='
-                        throw too_few_arguments("Missing value for option " + prepend_dash(id));
-                    input_value = (*option_it).substr(id_size + 1);
-                }
-                else // -kevValue
-                {
-                    input_value = (*option_it).substr(id_size);
-                }
-
-                *option_it = ""; // remove used identifier-value pair
+                detail::trace_span span{"validator", label};
+                detail::validator_probe probe{label};
+                validator(value);
             }
-            else // -key value
+            catch (std::exception & ex)
             {
-                *option_it = ""; // remove used identifier
-                ++option_it;
-                if (option_it == end_of_options_it) // should not happen
-                    throw too_few_arguments("Missing value for option " + prepend_dash(id));
-                input_value = *option_it;
-                *option_it = ""; // remove value
+                throw validation_error("Validation failed for " + std::string{label} + ": " + ex.what());
             }
 
-            auto res = parse_option_value(value, input_value);
-            throw_on_input_error<option_type>(res, prepend_dash(id), input_value);
-
-            return true;
+            if constexpr (std::invocable<sink_type &, value_type>)
+                std::invoke(sink, std::move(value));
+            else // output iterator
+                *sink++ = std::move(value);
         }
-        return false;
     }
 
-    /*!\brief Handles value retrieval (non container type) options.
-     *
-     * \param[out] value Stores the value found in arguments, parsed by parse_option_value.
-     * \param[in] id The option identifier supplied on the command line.
-     *
-     * \throws sharg::option_declared_multiple_times
-     *
-     * \details
-     *
-     * If the option identifier is found in format_parse::arguments, the value of
-     * the following position in arguments is tried to be parsed given the respective option value type
-     * and the identifier and value argument are removed from arguments.
-     *
-     * Returns true on success and false otherwise. This is needed to catch
-     * the user error of supplying multiple arguments for the same
-     * (non container!) option by specifying the short AND long identifier.
-     */
-    template <typename option_type, typename id_type>
-    bool get_option_by_id(option_type & value, id_type const & id)
+    //!\brief Calls get_option for the value and configuration of a parse_call.
+    template <typename option_type, typename validator_t>
+    static void call_get_option(format_parse & format, parse_call const & call)
     {
-        auto it = find_option_id(arguments.begin(), end_of_options_it, id);
-
-        if (it != end_of_options_it)
-            identify_and_retrieve_option_value(value, it, id);
-
-        if (find_option_id(it, end_of_options_it, id) != end_of_options_it) // should not be found again
-            throw option_declared_multiple_times("Option " + prepend_dash(id)
-                                                 + " is no list/container but declared multiple times.");
-
-        return (it != end_of_options_it); // first search was successful or not
+        auto const & option_config = *static_cast<config<validator_t> const *>(call.config);
+        detail::trace_span span{"option", trace_label(option_config)};
+        get_option(*static_cast<option_type *>(call.value), option_config, format.option_occurrences[call.index]);
     }
 
-    /*!\brief Handles value retrieval (container type) options.
-     *
-     * \param[out] value Stores all values found in arguments, parsed by parse_option_value.
-     * \param[in]  id    The option identifier supplied on the command line.
-     *
-     * \details
-     *
-     * Since option_type is a container, the option is a list and can be parsed
-     * multiple times.
-     *
-     */
-    template <detail::is_container_option option_type, typename id_type>
-    bool get_option_by_id(option_type & value, id_type const & id)
+    //!\brief Calls get_flag for the value of a parse_call.
+    static void call_get_flag(format_parse & format, parse_call const & call)
     {
-        auto it = find_option_id(arguments.begin(), end_of_options_it, id);
-        bool seen_at_least_once{it != end_of_options_it};
-
-        if (seen_at_least_once)
-            value.clear();
-
-        while (it != end_of_options_it)
-        {
-            identify_and_retrieve_option_value(value, it, id);
-            it = find_option_id(it, end_of_options_it, id);
-        }
-
-        return seen_at_least_once;
+        format.get_flag(*static_cast<bool *>(call.value), call.index);
     }
 
-    /*!\brief Checks format_parse::arguments for unknown options/flags.
-     *
-     * \throws sharg::unknown_option
-     *
-     * \details
-     *
-     * This function is used by format_parse::parse() AFTER all flags and options
-     * specified by the developer were parsed and therefore removed from arguments.
-     * Thus, all remaining flags/options are unknown.
-     *
-     * In addition this function removes "--" (if specified) from arguments to
-     * clean arguments for positional option retrieval.
-     */
-    void check_for_unknown_ids()
+    //!\brief Calls get_positional_option for the value and validator of a parse_call.
+    template <typename option_type, typename validator_t>
+    static void call_get_positional_option(format_parse & format, parse_call const & call)
     {
-        for (auto it = arguments.begin(); it != end_of_options_it; ++it)
-        {
-            std::string & arg{*it};
-            if (!arg.empty() && arg[0] == '-') // may be an identifier
-            {
-                if (arg == "-")
-                {
-                    continue; // positional option
-                }
-                else if (arg[1] != '-' && arg.size() > 2) // one dash, but more than one character (-> multiple flags)
-                {
-                    throw unknown_option("Unknown flags " + expand_multiple_flags(arg)
-                                         + ". In case this is meant to be a non-option/argument/parameter, "
-                                         + "please specify the start of arguments with '--'. "
-                                         + "See -h/--help for program information.");
-                }
-                else // unknown short or long option
-                {
-                    throw unknown_option("Unknown option " + arg
-                                         + ". In case this is meant to be a non-option/argument/parameter, "
-                                         + "please specify the start of non-options with '--'. "
-                                         + "See -h/--help for program information.");
-                }
-            }
-        }
+        detail::trace_span span{"positional option"};
+        get_positional_option(*static_cast<option_type *>(call.value),
+                              *static_cast<config<validator_t> const *>(call.config),
+                              format.positionals,
+                              format.definition->positional_option_calls.size());
     }
 
-    /*!\brief Checks format_parse::arguments for unknown options/flags.
-     *
-     * \throws sharg::too_many_arguments
-     *
-     * \details
-     *
-     * This function is used by format_parse::parse() AFTER all flags, options
-     * and positional options specified by the developer were parsed and
-     * therefore removed from arguments.
-     * Thus, all remaining non-empty arguments are too much.
-     */
-    void check_for_left_over_args()
+    //!\brief Calls get_option for the member of format_parse::target and the configuration of a member_binding.
+    template <typename object_type, typename option_type, typename validator_t>
+    static void call_get_member_option(format_parse & format, parse_call const & call)
     {
-        if (std::find_if(arguments.begin(),
-                         arguments.end(),
-                         [](std::string const & s)
-                         {
-                             return (s != "");
-                         })
-            != arguments.end())
-            throw too_many_arguments("Too many arguments provided. Please see -h/--help for more information.");
+        auto const & binding = *static_cast<member_binding<object_type, option_type, validator_t> const *>(call.config);
+        detail::trace_span span{"option", trace_label(binding.configuration)};
+        get_option(static_cast<object_type *>(format.target)->*binding.member,
+                   binding.configuration,
+                   format.option_occurrences[call.index]);
     }
 
-    /*!\brief Handles command line option retrieval.
-     *
-     * \param[out] value The variable in which to store the given command line argument.
-     * \param[in] config A configuration object to customise the sharg::parser behaviour. See sharg::config.
-     *
-     * \throws sharg::option_declared_multiple_times
-     * \throws sharg::validation_error
-     * \throws sharg::required_option_missing
-     *
-     * \details
-     *
-     * This function
-     * - checks if the option is required but not set,
-     * - retrieves any value found by the short or long identifier,
-     * - throws on (mis)use of both identifiers for non-container type values,
-     * - re-throws the validation exception with appended option information.
-     */
-    template <typename option_type, typename validator_t>
-    void get_option(option_type & value, config<validator_t> const & config)
+    //!\brief Calls get_flag for the member of format_parse::target of a member_binding.
+    template <typename object_type, typename validator_t>
+    static void call_get_member_flag(format_parse & format, parse_call const & call)
     {
-        bool short_id_is_set{get_option_by_id(value, config.short_id)};
-        bool long_id_is_set{get_option_by_id(value, config.long_id)};
-
-        // if value is no container we need to check for multiple declarations
-        if (short_id_is_set && long_id_is_set && !detail::is_container_option<option_type>)
-            throw option_declared_multiple_times("Option " + combine_option_names(config.short_id, config.long_id)
-                                                 + " is no list/container but specified multiple times");
-
-        if (short_id_is_set || long_id_is_set)
-        {
-            try
-            {
-                config.validator(value);
-            }
-            catch (std::exception & ex)
-            {
-                throw validation_error(std::string("Validation failed for option ")
-                                       + combine_option_names(config.short_id, config.long_id) + ": " + ex.what());
-            }
-        }
-        else // option is not set
-        {
-            // check if option is required
-            if (config.required)
-                throw required_option_missing("Option " + combine_option_names(config.short_id, config.long_id)
-                                              + " is required but not set.");
-        }
+        auto const & binding = *static_cast<member_binding<object_type, bool, validator_t> const *>(call.config);
+        format.get_flag(static_cast<object_type *>(format.target)->*binding.member, call.index);
     }
 
-    /*!\brief Handles command line flags, whether they are set or not.
-     *
-     * \param[out] value    The variable which shows if the flag is turned off (default) or on.
-     * \param[in]  short_id The short identifier for the flag (e.g. 'i').
-     * \param[in]  long_id  The long identifier for the flag (e.g. "integer").
-     *
-     */
-    void get_flag(bool & value, char const short_id, std::string const & long_id)
+    //!\brief Calls get_positional_option for the member of format_parse::target and the validator of a member_binding.
+    template <typename object_type, typename option_type, typename validator_t>
+    static void call_get_member_positional_option(format_parse & format, parse_call const & call)
     {
-        // `|| value` is needed to keep the value if it was set before.
-        // It must be last because `flag_is_set` removes the flag from the arguments.
-        value = flag_is_set(short_id) || flag_is_set(long_id) || value;
+        auto const & binding = *static_cast<member_binding<object_type, option_type, validator_t> const *>(call.config);
+        detail::trace_span span{"positional option"};
+        get_positional_option(static_cast<object_type *>(format.target)->*binding.member,
+                              binding.configuration,
+                              format.positionals,
+                              format.definition->positional_option_calls.size());
     }
 
-    /*!\brief Handles command line positional option retrieval.
-     *
-     * \param[out] value     The variable in which to store the given command line argument.
-     * \param[in]  validator The validator applied to the value after parsing (callable).
-     *
-     * \throws sharg::parser_error
-     * \throws sharg::too_few_arguments
-     * \throws sharg::validation_error
-     * \throws sharg::design_error
-     *
-     * \details
-     *
-     * This function assumes that
-     * -#) arguments has been stripped from all known options and flags
-     * -#) arguments has been checked for unknown options
-     * -#) arguments does not contain "--" anymore
-     *  Thus we can simply iterate over non empty entries of arguments.
-     *
-     * This function
-     * - checks if the user did not provide enough arguments,
-     * - retrieves the next (no container type) or all (container type) remaining non empty value/s in arguments
-     */
-    template <typename option_type, typename validator_type>
-    void get_positional_option(option_type & value, validator_type && validator)
+    //!\brief Calls get_positional_option_sink for the sink and validator of a parse_call.
+    template <typename value_type, typename sink_type, typename validator_t>
+    static void call_get_positional_option_sink(format_parse & format, parse_call const & call)
     {
-        ++positional_option_count;
-        auto it = std::find_if(arguments.begin(),
-                               arguments.end(),
-                               [](std::string const & s)
-                               {
-                                   return (s != "");
-                               });
-
-        if (it == arguments.end())
-            throw too_few_arguments("Not enough positional arguments provided (Need at least "
-                                    + std::to_string(positional_option_calls.size())
-                                    + "). See -h/--help for more information.");
-
-        if constexpr (detail::is_container_option<
-                          option_type>) // vector/list will be filled with all remaining arguments
-        {
-            assert(positional_option_count == positional_option_calls.size()); // checked on set up.
-
-            value.clear();
-
-            while (it != arguments.end())
-            {
-                auto res = parse_option_value(value, *it);
-                std::string id = "positional option" + std::to_string(positional_option_count);
-                throw_on_input_error<option_type>(res, id, *it);
-
-                *it = ""; // remove arg from arguments
-                it = std::find_if(it,
-                                  arguments.end(),
-                                  [](std::string const & s)
-                                  {
-                                      return (s != "");
-                                  });
-                ++positional_option_count;
-            }
-        }
-        else
-        {
-            auto res = parse_option_value(value, *it);
-            std::string id = "positional option" + std::to_string(positional_option_count);
-            throw_on_input_error<option_type>(res, id, *it);
-
-            *it = ""; // remove arg from arguments
-        }
-
-        try
-        {
-            validator(value);
-        }
-        catch (std::exception & ex)
-        {
-            throw validation_error("Validation failed for positional option " + std::to_string(positional_option_count)
-                                   + ": " + ex.what());
-        }
+        detail::trace_span span{"positional option"};
+        format.get_positional_option_sink<value_type>(*static_cast<sink_type *>(call.value),
+                                                      static_cast<config<validator_t> const *>(call.config)->validator);
     }
 
-    //!\brief Stores get_option calls to be evaluated when calling format_parse::parse().
-    std::vector<std::function<void()>> option_calls;
-    //!\brief Stores get_flag calls to be evaluated when calling format_parse::parse().
-    std::vector<std::function<void()>> flag_calls;
-    //!\brief Stores get_positional_option calls to be evaluated when calling format_parse::parse().
-    std::vector<std::function<void()>> positional_option_calls;
-    //!\brief Keeps track of the number of specified positional options.
-    unsigned positional_option_count{0};
-    //!\brief Vector of command line arguments.
-    std::vector<std::string> arguments;
-    //!\brief Artificial end of arguments if \-- was seen.
-    std::vector<std::string>::iterator end_of_options_it;
+    //!\brief The registered options if they were added to this format; `nullptr` if constructed from a prototype.
+    std::unique_ptr<definition_type> owned_definition{};
+    //!\brief The registered options; format_parse::owned_definition or the definition of the prototype.
+    definition_type const * definition{};
+    //!\brief The command line arguments.
+    std::span<std::string_view const> arguments;
+    //!\brief The position of each of format_parse::arguments on the original command line; may be empty.
+    std::span<size_t const> argument_positions;
+    //!\brief The object whose members the options of a sharg::detail::member_binding are stored in.
+    void * target{};
+    //!\brief The values given on the command line, per option in order of format_parse::definition_type::option_calls.
+    std::vector<std::vector<option_occurrence>> option_occurrences;
+    //!\brief The positions of the arguments specifying an option or flag, in order of the registered identifiers.
+    std::vector<std::vector<size_t>> id_positions;
+    //!\brief The first identifier given on the command line that is not known.
+    std::string unknown_id;
+    //!\brief The positional arguments and the progress of retrieving them.
+    positional_state positionals{};
 };
 
 } // namespace sharg::detail
@@ -373,7 +373,7 @@ public:
         {
             throw std::runtime_error("unsupported file format (this is a bug)");
         }
-        std::exit(EXIT_SUCCESS); // program should not continue from here
+        // sharg::parser::parse exits after any format other than sharg::detail::format_parse.
     }
 
     /*!\brief Adds a print_section call to parser_set_up_calls.
@@ -9,9 +9,8 @@
 
 #pragma once
 
-#include <algorithm>
+#include <concepts>
 #include <string>
-#include <unordered_set>
 
 #include <sharg/platform.hpp>
 
@@ -97,21 +96,6 @@ struct id_pair
     //!\brief Checks whether id is empty.
     template <typename id_type>
     static bool empty(id_type const & id) noexcept;
-
-    // Note: The following two functions are declared, but not defined.
-    // We first need to specialise std::hash<id_pair> in the std namespace.
-    // After that, we can define the functions.
-    // Defining them here would generate std::hash<id_pair> before the specialisation.
-    // 1.) Now there are two specialisations for std::hash<id_pair> (error)
-    // 2.) The default-generated std::hash<id_pair> does actually not work
-
-    //!\brief Finds an id_pair in a set of used ids.
-    template <typename id_type>
-    static auto find(std::unordered_set<id_pair> const & used_ids, id_type const & id);
-
-    //!\brief Checks whether an id is already contained in a set of used ids.
-    template <typename id_type>
-    static bool contains(std::unordered_set<id_pair> const & used_ids, id_type const & id);
 };
 
 } // namespace sharg::detail
@@ -150,23 +134,4 @@ inline bool id_pair::empty(id_type const & id) noexcept
         return id.empty();
 }
 
-template <typename id_type>
-inline auto id_pair::find(std::unordered_set<id_pair> const & used_ids, id_type const & id)
-{
-    if (empty(id))
-        return used_ids.end();
-
-    return std::ranges::find_if(used_ids,
-                                [&id](id_pair const & pair)
-                                {
-                                    return pair == id;
-                                });
-}
-
-template <typename id_type>
-inline bool id_pair::contains(std::unordered_set<id_pair> const & used_ids, id_type const & id)
-{
-    return find(used_ids, id) != used_ids.end();
-}
-
 } // namespace sharg::detail
@@ -0,0 +1,181 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \author Enrico Seiler <enrico.seiler AT fu-berlin.de>
+ * \brief Provides sharg::detail::id_registry and sharg::detail::string_hash.
+ */
+
+#pragma once
+
+#include <array>
+#include <initializer_list>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <sharg/detail/id_pair.hpp>
+
+namespace sharg::detail
+{
+
+/*!\brief A hash for strings that enables heterogeneous lookup, e.g. of std::string_view in unordered containers
+ *        with std::string keys.
+ * \ingroup parser
+ */
+struct string_hash
+{
+    using is_transparent = void; //!< Enables heterogeneous lookup.
+
+    //!\brief Returns the hash of the given string.
+    size_t operator()(std::string_view const str) const noexcept
+    {
+        return std::hash<std::string_view>{}(str);
+    }
+};
+
+/*!\brief Stores the identifiers of options and flags and finds them in constant time.
+ * \ingroup parser
+ *
+ * \details
+ *
+ * Each registered sharg::detail::id_pair is assigned its position in the order of registration.
+ * Short identifiers are indexed by a table with one entry per `char` value, long identifiers by a hash map.
+ * Hence, registering `n` identifiers takes `O(n)` and each lookup takes `O(1)` (expected).
+ *
+ * The registry does not check whether an identifier is already contained. Use sharg::detail::id_registry::contains
+ * before sharg::detail::id_registry::emplace to detect duplicates.
+ */
+class id_registry
+{
+public:
+    //!\brief The value returned by sharg::detail::id_registry::find if an identifier is not registered.
+    static constexpr size_t npos{std::numeric_limits<size_t>::max()};
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    id_registry() = default;                                //!< Defaulted.
+    id_registry(id_registry const &) = default;             //!< Defaulted.
+    id_registry & operator=(id_registry const &) = default; //!< Defaulted.
+    id_registry(id_registry &&) = default;                  //!< Defaulted.
+    id_registry & operator=(id_registry &&) = default;      //!< Defaulted.
+    ~id_registry() = default;                               //!< Defaulted.
+
+    /*!\brief Registers the given identifiers.
+     * \param[in] ids The identifiers to register.
+     */
+    id_registry(std::initializer_list<id_pair> ids)
+    {
+        for (id_pair const & id : ids)
+            emplace(id.short_id, id.long_id);
+    }
+    //!\}
+
+    /*!\brief Registers a short and a long identifier that belong to the same option or flag.
+     * \param[in] short_id The short identifier; not indexed if empty.
+     * \param[in] long_id  The long identifier; not indexed if empty.
+     * \returns The position of the registered identifiers.
+     */
+    size_t emplace(char const short_id, std::string long_id)
+    {
+        size_t const position = ids.size();
+
+        if (short_id != '\0')
+            short_id_index[to_index(short_id)] = position;
+
+        if (!long_id.empty())
+            long_id_index.emplace(long_id, position);
+
+        ids.emplace_back(short_id, std::move(long_id));
+
+        return position;
+    }
+
+    /*!\brief Returns the position of a short identifier.
+     * \param[in] short_id The short identifier to search for.
+     * \returns The position of `short_id` or sharg::detail::id_registry::npos if it is empty or not registered.
+     */
+    size_t find(char const short_id) const noexcept
+    {
+        return (short_id == '\0') ? npos : short_id_index[to_index(short_id)];
+    }
+
+    /*!\brief Returns the position of a long identifier.
+     * \param[in] long_id The long identifier to search for.
+     * \returns The position of `long_id` or sharg::detail::id_registry::npos if it is empty or not registered.
+     */
+    size_t find(std::string_view const long_id) const
+    {
+        if (long_id.empty())
+            return npos;
+
+        auto it = long_id_index.find(long_id);
+        return (it == long_id_index.end()) ? npos : it->second;
+    }
+
+    //!\copydoc find(std::string_view const) const
+    size_t find(std::string const & long_id) const
+    {
+        return find(std::string_view{long_id});
+    }
+
+    /*!\brief Returns the position of an id_pair.
+     * \param[in] id The identifiers to search for.
+     * \returns The position of the registered identifiers whose short **or** long identifier equals the respective
+     *          identifier of `id`, or sharg::detail::id_registry::npos if there is none.
+     */
+    size_t find(id_pair const & id) const
+    {
+        if (size_t const position = find(id.short_id); position != npos)
+            return position;
+
+        return find(std::string_view{id.long_id});
+    }
+
+    //!\brief Checks whether an identifier is registered.
+    template <typename id_type>
+    bool contains(id_type const & id) const
+    {
+        return find(id) != npos;
+    }
+
+    //!\brief Returns the identifiers registered at `position`.
+    id_pair const & operator[](size_t const position) const noexcept
+    {
+        return ids[position];
+    }
+
+    //!\brief Returns the number of registered identifier pairs.
+    size_t size() const noexcept
+    {
+        return ids.size();
+    }
+
+private:
+    //!\brief Returns the position of a short identifier in id_registry::short_id_index.
+    static constexpr size_t to_index(char const short_id) noexcept
+    {
+        return static_cast<unsigned char>(short_id);
+    }
+
+    //!\brief Creates a table where no short identifier is registered.
+    static constexpr std::array<size_t, 256> empty_short_id_index() noexcept
+    {
+        std::array<size_t, 256> table{};
+        table.fill(npos);
+        return table;
+    }
+
+    //!\brief The registered identifiers in order of registration.
+    std::vector<id_pair> ids{};
+    //!\brief Maps each short identifier to its position.
+    std::array<size_t, 256> short_id_index{empty_short_id_index()};
+    //!\brief Maps each long identifier to its position.
+    std::unordered_map<std::string, size_t, string_hash, std::equal_to<>> long_id_index{};
+};
+
+} // namespace sharg::detail
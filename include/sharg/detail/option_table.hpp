@@ -0,0 +1,357 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \author Svenja Mehringer <svenja.mehringer AT fu-berlin.de>
+ * \brief Provides sharg::detail::option_table.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <sharg/config.hpp>
+
+namespace sharg::detail
+{
+
+/*!\brief Stores every option, flag, positional option and help page element added to a sharg::parser once.
+ * \ingroup parser
+ * \tparam format_variant_t The std::variant of formats the stored elements are added to.
+ *
+ * \details
+ *
+ * The elements are only added to the format when calling sharg::parser::parse, because the format is not known
+ * before. Each call to, e.g., sharg::parser::add_option is stored as an entry in a contiguous table.
+ * An entry consists of a pointer to the value, a pointer to the sharg::config and a function pointer that
+ * adds the option to the format given the respective option and validator type.
+ *
+ * The sharg::config objects (and the strings of help page elements) are constructed in a monotonic arena.
+ * Their addresses are therefore stable for the lifetime of the table, which allows the formats to refer to them
+ * instead of copying them.
+ */
+template <typename format_variant_t>
+class option_table
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    option_table() = default;                                 //!< Defaulted.
+    option_table(option_table const &) = delete;              //!< Deleted.
+    option_table & operator=(option_table const &) = delete;  //!< Deleted.
+
+    //!\brief Move constructor. The moved-from table is empty.
+    option_table(option_table && other) noexcept :
+        entries{std::exchange(other.entries, {})},
+        arena{std::move(other.arena)}
+    {}
+
+    //!\brief Move assignment. The moved-from table is empty.
+    option_table & operator=(option_table && other) noexcept
+    {
+        if (this != &other)
+        {
+            destroy_entries();
+            entries = std::exchange(other.entries, {});
+            arena = std::move(other.arena);
+        }
+        return *this;
+    }
+
+    //!\brief Destroys all stored configurations.
+    ~option_table()
+    {
+        destroy_entries();
+    }
+    //!\}
+
+    /*!\brief Stores an sharg::parser::add_option call.
+     * \param[in] value  The variable in which to store the given command line argument.
+     * \param[in] config The configuration of the option; copied into the arena.
+     */
+    template <typename option_type, typename validator_t>
+    void add_option(option_type & value, config<validator_t> const & config)
+    {
+        emplace(&add_option_to<option_type, validator_t>, &value, config);
+    }
+
+    /*!\brief Stores an sharg::parser::add_flag call.
+     * \param[in] value  The variable which shows if the flag is turned off (default) or on.
+     * \param[in] config The configuration of the flag; copied into the arena.
+     */
+    template <typename validator_t>
+    void add_flag(bool & value, config<validator_t> const & config)
+    {
+        emplace(&add_flag_to<validator_t>, &value, config);
+    }
+
+    /*!\brief Stores an sharg::parser::add_positional_option call.
+     * \param[in] value  The variable in which to store the given command line argument.
+     * \param[in] config The configuration of the positional option; copied into the arena.
+     */
+    template <typename option_type, typename validator_t>
+    void add_positional_option(option_type & value, config<validator_t> const & config)
+    {
+        emplace(&add_positional_option_to<option_type, validator_t>, &value, config);
+    }
+
+    /*!\brief Stores an sharg::parser::add_positional_option_sink call.
+     * \param[in] sink   The sink that receives the values; moved into the arena.
+     * \param[in] config The configuration of the positional option; copied into the arena.
+     */
+    template <typename value_type, typename sink_type, typename validator_t>
+    void add_positional_option_sink(sink_type sink, config<validator_t> const & config)
+    {
+        emplace(&add_positional_option_sink_to<value_type, sink_type, validator_t>,
+                nullptr,
+                positional_sink<sink_type, validator_t>{std::move(sink), config});
+    }
+
+    //!\brief Stores an sharg::parser::add_section call.
+    void add_section(std::string const & title, bool const advanced_only)
+    {
+        emplace(&add_section_to, nullptr, help_page_text{title, {}, false, advanced_only});
+    }
+
+    //!\brief Stores an sharg::parser::add_subsection call.
+    void add_subsection(std::string const & title, bool const advanced_only)
+    {
+        emplace(&add_subsection_to, nullptr, help_page_text{title, {}, false, advanced_only});
+    }
+
+    //!\brief Stores an sharg::parser::add_line call.
+    void add_line(std::string const & text, bool const is_paragraph, bool const advanced_only)
+    {
+        emplace(&add_line_to, nullptr, help_page_text{text, {}, is_paragraph, advanced_only});
+    }
+
+    //!\brief Stores an sharg::parser::add_list_item call.
+    void add_list_item(std::string const & key, std::string const & desc, bool const advanced_only)
+    {
+        emplace(&add_list_item_to, nullptr, help_page_text{key, desc, false, advanced_only});
+    }
+
+    /*!\brief Adds all stored elements to the given format, in the order they were stored.
+     * \param[in,out] format The format to add the elements to.
+     */
+    void add_to(format_variant_t & format) const
+    {
+        for (entry const & e : entries)
+            e.add_to(format, e);
+    }
+
+    //!\brief Returns the number of stored elements.
+    size_t size() const noexcept
+    {
+        return entries.size();
+    }
+
+private:
+    //!\brief The text of a help page element, e.g. added by sharg::parser::add_section.
+    struct help_page_text
+    {
+        std::string text{};        //!< The title, line or key of the element.
+        std::string description{}; //!< The description of a list item.
+        bool is_paragraph{};       //!< Whether a line is a paragraph.
+        bool advanced_only{};      //!< Whether the element is only shown on the advanced help page.
+    };
+
+    //!\brief The sink and configuration of a sharg::parser::add_positional_option_sink call.
+    template <typename sink_type, typename validator_t>
+    struct positional_sink
+    {
+        mutable sink_type sink;                   //!< The sink; modified when parsing.
+        sharg::config<validator_t> configuration; //!< The configuration of the positional option.
+    };
+
+    //!\brief A stored element.
+    struct entry
+    {
+        //!\brief Adds the element to the format given the respective option and validator type.
+        void (*add_to)(format_variant_t &, entry const &);
+        //!\brief Destroys the object pointed to by entry::data.
+        void (*destroy)(void const *) noexcept;
+        //!\brief The variable of the option, flag or positional option. `nullptr` for help page elements.
+        void * value;
+        //!\brief The configuration or help page text, constructed in option_table::arena.
+        void const * data;
+    };
+
+    //!\brief The initial size of the arena. Fits the configurations of a few dozen options.
+    static constexpr size_t initial_arena_size{4096};
+
+    /*!\brief Constructs a copy of `data` in the arena and appends an entry referring to it.
+     * \param[in] add_to The function that adds the element to the format.
+     * \param[in] value  The variable of the element.
+     * \param[in] data   The configuration or help page text of the element.
+     */
+    template <typename data_t>
+    void emplace(void (*add_to)(format_variant_t &, entry const &), void * value, data_t && data)
+    {
+        using stored_t = std::remove_cvref_t<data_t>;
+
+        if (!arena)
+            arena = std::make_unique<std::pmr::monotonic_buffer_resource>(initial_arena_size);
+
+        // Make sure that push_back does not throw after construction. Grow geometrically, i.e. amortised O(1).
+        if (entries.size() == entries.capacity())
+            entries.reserve(std::max<size_t>(2u * entries.capacity(), 16u));
+
+        void * memory = arena->allocate(sizeof(stored_t), alignof(stored_t));
+        stored_t const * stored = ::new (memory) stored_t(std::forward<data_t>(data));
+
+        entries.push_back(entry{add_to, &destroy<stored_t>, value, stored});
+    }
+
+    //!\brief Destroys an object constructed by option_table::emplace.
+    template <typename data_t>
+    static void destroy(void const * data) noexcept
+    {
+        static_cast<data_t const *>(data)->~data_t();
+    }
+
+    //!\brief Destroys all objects in the arena. The memory is released when the arena is destroyed.
+    void destroy_entries() noexcept
+    {
+        for (entry const & e : entries)
+            e.destroy(e.data);
+
+        entries.clear();
+    }
+
+    //!\brief Returns the configuration of an entry.
+    template <typename validator_t>
+    static config<validator_t> const & config_of(entry const & e)
+    {
+        return *static_cast<config<validator_t> const *>(e.data);
+    }
+
+    //!\brief Returns the help page text of an entry.
+    static help_page_text const & text_of(entry const & e)
+    {
+        return *static_cast<help_page_text const *>(e.data);
+    }
+
+    //!\brief Calls `add_option` of the format.
+    template <typename option_type, typename validator_t>
+    static void add_option_to(format_variant_t & format, entry const & e)
+    {
+        std::visit(
+            [&e](auto & f)
+            {
+                f.add_option(*static_cast<option_type *>(e.value), config_of<validator_t>(e));
+            },
+            format);
+    }
+
+    //!\brief Calls `add_flag` of the format.
+    template <typename validator_t>
+    static void add_flag_to(format_variant_t & format, entry const & e)
+    {
+        std::visit(
+            [&e](auto & f)
+            {
+                f.add_flag(*static_cast<bool *>(e.value), config_of<validator_t>(e));
+            },
+            format);
+    }
+
+    //!\brief Calls `add_positional_option` of the format.
+    template <typename option_type, typename validator_t>
+    static void add_positional_option_to(format_variant_t & format, entry const & e)
+    {
+        std::visit(
+            [&e](auto & f)
+            {
+                f.add_positional_option(*static_cast<option_type *>(e.value), config_of<validator_t>(e));
+            },
+            format);
+    }
+
+    /*!\brief Calls `add_positional_option_sink` of the format.
+     * \details
+     * Formats without `add_positional_option_sink`, i.e. the help page formats, document the sink as a positional
+     * list option of `value_type`.
+     */
+    template <typename value_type, typename sink_type, typename validator_t>
+    static void add_positional_option_sink_to(format_variant_t & format, entry const & e)
+    {
+        auto const & stored = *static_cast<positional_sink<sink_type, validator_t> const *>(e.data);
+
+        std::visit(
+            [&sink = stored.sink, &config = stored.configuration](auto & f)
+            {
+                if constexpr (requires { f.template add_positional_option_sink<value_type>(sink, config); })
+                {
+                    f.template add_positional_option_sink<value_type>(sink, config);
+                }
+                else
+                {
+                    std::vector<value_type> list{};
+                    f.add_positional_option(list, config);
+                }
+            },
+            format);
+    }
+
+    //!\brief Calls `add_section` of the format.
+    static void add_section_to(format_variant_t & format, entry const & e)
+    {
+        std::visit(
+            [&text = text_of(e)](auto & f)
+            {
+                f.add_section(text.text, text.advanced_only);
+            },
+            format);
+    }
+
+    //!\brief Calls `add_subsection` of the format.
+    static void add_subsection_to(format_variant_t & format, entry const & e)
+    {
+        std::visit(
+            [&text = text_of(e)](auto & f)
+            {
+                f.add_subsection(text.text, text.advanced_only);
+            },
+            format);
+    }
+
+    //!\brief Calls `add_line` of the format.
+    static void add_line_to(format_variant_t & format, entry const & e)
+    {
+        std::visit(
+            [&text = text_of(e)](auto & f)
+            {
+                f.add_line(text.text, text.is_paragraph, text.advanced_only);
+            },
+            format);
+    }
+
+    //!\brief Calls `add_list_item` of the format.
+    static void add_list_item_to(format_variant_t & format, entry const & e)
+    {
+        std::visit(
+            [&text = text_of(e)](auto & f)
+            {
+                f.add_list_item(text.text, text.description, text.advanced_only);
+            },
+            format);
+    }
+
+    //!\brief The stored elements in order of addition.
+    std::vector<entry> entries{};
+    //!\brief Owns the memory of the configurations and help page texts.
+    std::unique_ptr<std::pmr::monotonic_buffer_resource> arena{};
+};
+
+} // namespace sharg::detail
@@ -0,0 +1,226 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \author Enrico Seiler <enrico.seiler AT fu-berlin.de>
+ * \brief Provides sharg::detail::parallel_validation.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <exception>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <ranges>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include <sharg/platform.hpp>
+
+namespace sharg::detail
+{
+
+/*!\brief Whether sharg::detail::parallel_validation can apply `validator_t` to each element of `range_t`.
+ * \ingroup misc
+ */
+template <typename range_t, typename validator_t>
+concept parallel_validatable = std::ranges::random_access_range<range_t const>
+                            && std::ranges::sized_range<range_t const>
+                            && std::invocable<validator_t const &, std::ranges::range_reference_t<range_t const>>;
+
+/*!\brief Applies a validator to each element of a range using a bounded work-stealing thread pool.
+ * \ingroup misc
+ *
+ * \details
+ *
+ * The indices of the range are split into one contiguous block per thread. Each thread validates its block from
+ * the front; a thread that runs out of work steals the back half of the block of another thread.
+ * After an element failed validation, no element behind it is validated anymore. Elements in front of it are still
+ * validated, such that the exception of the first invalid element is rethrown, regardless of the scheduling.
+ * This is the same exception that a sequential validation would throw.
+ *
+ * The validator must be safe to call concurrently.
+ */
+class parallel_validation
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    parallel_validation() = default;                                        //!< Defaulted.
+    parallel_validation(parallel_validation const &) = default;             //!< Defaulted.
+    parallel_validation & operator=(parallel_validation const &) = default; //!< Defaulted.
+    parallel_validation(parallel_validation &&) = default;                  //!< Defaulted.
+    parallel_validation & operator=(parallel_validation &&) = default;      //!< Defaulted.
+    ~parallel_validation() = default;                                       //!< Defaulted.
+
+    /*!\brief Constructs the thread pool with a maximum number of threads.
+     * \param[in] thread_count The maximum number of threads, including the calling thread. `0` is treated as `1`.
+     */
+    explicit parallel_validation(size_t const thread_count) : thread_count{std::max<size_t>(thread_count, 1u)}
+    {}
+    //!\}
+
+    /*!\brief Validates each element of `values`.
+     * \param[in] values    The range of values.
+     * \param[in] validator The validator to apply to each element.
+     * \throws Any exception thrown by `validator` for the first invalid element.
+     */
+    template <typename range_t, typename validator_t>
+        requires parallel_validatable<range_t, validator_t>
+    void operator()(range_t const & values, validator_t const & validator) const
+    {
+        size_t const size = std::ranges::size(values);
+        size_t const worker_count = std::min(thread_count, size);
+
+        if (worker_count <= 1u)
+        {
+            for (auto && value : values)
+                validator(value);
+            return;
+        }
+
+        state shared{values, validator, worker_count};
+
+        {
+            std::vector<std::jthread> threads{};
+            threads.reserve(worker_count - 1u);
+
+            try
+            {
+                for (size_t i = 1u; i < worker_count; ++i)
+                    threads.emplace_back(&state<range_t, validator_t>::work, &shared, i);
+            }
+            catch (std::system_error const &) // No more threads available. The running workers steal the work.
+            {}
+
+            shared.work(0u); // The calling thread is a worker, too.
+        } // Joins all threads.
+
+        if (shared.failure)
+            std::rethrow_exception(shared.failure);
+    }
+
+private:
+    //!\brief The maximum number of threads, including the calling thread.
+    size_t thread_count{std::max<unsigned>(std::thread::hardware_concurrency(), 1u)};
+
+    //!\brief The half-open index interval `[begin, end)` that a worker has yet to validate.
+    struct alignas(64) block
+    {
+        std::mutex mutex{}; //!< Guards begin and end.
+        size_t begin{};     //!< The next index to validate by the owning worker.
+        size_t end{};       //!< One past the last index of the block.
+    };
+
+    //!\brief The state shared by all workers of one operator() call.
+    template <typename range_t, typename validator_t>
+    struct state
+    {
+        //!\brief Splits the indices of `values` evenly into `worker_count` blocks.
+        state(range_t const & values, validator_t const & validator, size_t const worker_count) :
+            values{values},
+            validator{validator},
+            blocks{std::make_unique<block[]>(worker_count)},
+            worker_count{worker_count}
+        {
+            size_t const size = std::ranges::size(values);
+
+            for (size_t i = 0; i < worker_count; ++i)
+            {
+                blocks[i].begin = size * i / worker_count;
+                blocks[i].end = size * (i + 1u) / worker_count;
+            }
+        }
+
+        range_t const & values;                          //!< The values to validate.
+        validator_t const & validator;                   //!< The validator.
+        std::unique_ptr<block[]> blocks;                 //!< One block per worker.
+        size_t worker_count;                             //!< The number of workers.
+        std::atomic<size_t> first_failure{no_failure};   //!< The index of the first invalid value found so far.
+        std::mutex failure_mutex{};                      //!< Guards failure.
+        std::exception_ptr failure{};                    //!< The exception of the value at first_failure.
+        static constexpr size_t no_failure{std::numeric_limits<size_t>::max()}; //!< No value failed (yet).
+
+        //!\brief Validates values until no worker has any work left.
+        void work(size_t const worker)
+        {
+            block & own = blocks[worker];
+
+            for (size_t index{}; next_index(own, index) || (steal(worker) && next_index(own, index));)
+            {
+                try
+                {
+                    validator(std::ranges::begin(values)[index]);
+                }
+                catch (...)
+                {
+                    std::lock_guard lock{failure_mutex};
+
+                    if (index < first_failure.load(std::memory_order_relaxed))
+                    {
+                        failure = std::current_exception();
+                        first_failure.store(index, std::memory_order_relaxed);
+                    }
+                }
+            }
+        }
+
+        /*!\brief Takes the first index of a block.
+         * \returns `false` if the block is empty or only contains indices behind an invalid value.
+         */
+        bool next_index(block & own, size_t & index)
+        {
+            std::lock_guard lock{own.mutex};
+
+            // All values behind a failure are skipped.
+            own.end = std::min(own.end, first_failure.load(std::memory_order_relaxed));
+
+            if (own.begin >= own.end)
+                return false;
+
+            index = own.begin++;
+            return true;
+        }
+
+        //!\brief Moves the back half of another worker's block into the (empty) block of `worker`.
+        bool steal(size_t const worker)
+        {
+            for (size_t offset = 1u; offset < worker_count; ++offset)
+            {
+                block & victim = blocks[(worker + offset) % worker_count];
+                size_t begin{};
+                size_t end{};
+
+                {
+                    std::lock_guard lock{victim.mutex};
+                    size_t const victim_end = std::min(victim.end, first_failure.load(std::memory_order_relaxed));
+
+                    if (victim.begin >= victim_end)
+                        continue;
+
+                    begin = victim.begin + (victim_end - victim.begin) / 2u;
+                    end = victim_end;
+                    victim.end = begin;
+                }
+
+                block & own = blocks[worker];
+                std::lock_guard lock{own.mutex};
+                own.begin = begin;
+                own.end = end;
+                return true;
+            }
+
+            return false;
+        }
+    };
+};
+
+} // namespace sharg::detail
@@ -0,0 +1,106 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \author Enrico Seiler <enrico.seiler AT fu-berlin.de>
+ * \brief Provides sharg::detail::fast_path_type and sharg::detail::fast_path_access.
+ */
+
+#pragma once
+
+#ifdef __linux__
+#    include <fcntl.h>
+#    include <unistd.h>
+
+#    include <sys/stat.h>
+#endif
+
+#include <cerrno>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+
+#include <sharg/platform.hpp>
+
+/*!\brief Whether the file validators query the file system with `statx` and `faccessat`.
+ * \ingroup misc
+ * \details
+ * Defaults to 1 on Linux if `statx` is declared. Define as 0 to always use `std::filesystem`.
+ */
+#ifndef SHARG_HAS_STATX
+#    if defined(__linux__) && defined(STATX_TYPE)
+#        define SHARG_HAS_STATX 1
+#    else
+#        define SHARG_HAS_STATX 0
+#    endif
+#endif
+
+namespace sharg::detail
+{
+
+//!\brief The type of a file system entry as reported by sharg::detail::fast_path_type.
+enum class path_type : uint8_t
+{
+    not_found,    //!< The path does not exist.
+    regular_file, //!< The path is a regular file.
+    directory,    //!< The path is a directory.
+    other         //!< The path is neither a regular file nor a directory, e.g. a FIFO.
+};
+
+//!\brief The permission checked by sharg::detail::fast_path_access.
+enum class path_access : uint8_t
+{
+    read,  //!< The file can be read, or the directory can be listed.
+    write, //!< The file can be written.
+    create //!< Entries can be created in the directory, i.e. it is writable and searchable.
+};
+
+/*!\brief Determines the type of a path with a single `statx` call. Symbolic links are followed.
+ * \ingroup misc
+ * \param[in] path The path to query.
+ * \returns The type of the path, or `std::nullopt` if the fast path is not available or the error is not one of
+ *          "does not exist". The caller then needs to fall back to `std::filesystem`.
+ */
+inline std::optional<path_type> fast_path_type([[maybe_unused]] std::filesystem::path const & path) noexcept
+{
+#if SHARG_HAS_STATX
+    struct statx status{};
+
+    if (::statx(AT_FDCWD, path.c_str(), AT_STATX_SYNC_AS_STAT, STATX_TYPE, &status) == 0)
+    {
+        if (!(status.stx_mask & STATX_TYPE))
+            return std::nullopt;
+        else if (S_ISREG(status.stx_mode))
+            return path_type::regular_file;
+        else if (S_ISDIR(status.stx_mode))
+            return path_type::directory;
+        else
+            return path_type::other;
+    }
+
+    if (errno == ENOENT || errno == ENOTDIR)
+        return path_type::not_found;
+#endif
+
+    return std::nullopt;
+}
+
+/*!\brief Checks a permission of a path with a single `faccessat` call using the effective user and group IDs.
+ * \ingroup misc
+ * \param[in] path   The path to check.
+ * \param[in] access The permission to check.
+ * \returns Whether the permission is granted. Always `false` if sharg::detail::fast_path_type is not available.
+ */
+inline bool fast_path_access([[maybe_unused]] std::filesystem::path const & path,
+                             [[maybe_unused]] path_access const access) noexcept
+{
+#if SHARG_HAS_STATX
+    int const mode = (access == path_access::read) ? R_OK : (access == path_access::write) ? W_OK : W_OK | X_OK;
+    return ::faccessat(AT_FDCWD, path.c_str(), mode, AT_EACCESS) == 0;
+#else
+    return false;
+#endif
+}
+
+} // namespace sharg::detail
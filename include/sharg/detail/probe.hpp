@@ -0,0 +1,101 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \author Enrico Seiler <enrico.seiler AT fu-berlin.de>
+ * \brief Provides the USDT probes of Sharg and sharg::detail::validator_probe.
+ *
+ * \details
+ *
+ * If Sharg is configured with the CMake option `SHARG_WITH_USDT` and `<sys/sdt.h>` is available, `SHARG_HAS_USDT` is
+ * set to `1` and the parser contains the following static probes of the provider `sharg`:
+ *
+ * | Probe                 | Arguments                                                                  |
+ * |-----------------------|----------------------------------------------------------------------------|
+ * | `parse_start`         | application name (`char const *`)                                          |
+ * | `parse_end`           | application name (`char const *`)                                          |
+ * | `option_match`        | option index, argument (`char const *`), argument length                   |
+ * | `validator_entry`     | option identifier (`char const *`), identifier length                      |
+ * | `validator_exit`      | option identifier (`char const *`), identifier length, duration in ns      |
+ * | `sub_parser_create`   | name of the sub-parser (`char const *`)                                    |
+ * | `version_check_spawn` | process id of the server call                                              |
+ *
+ * `parse_end` is not reached if parsing throws. The identifier of positional options is, e.g., "positional option 1".
+ * The probes can be listed with `readelf -n <app>` and used by `perf` or `bpftrace`, e.g.
+ * `bpftrace -e 'usdt:./app:sharg:validator_exit { @[str(arg0, arg1)] = hist(arg2); }' -c './app ...'`.
+ *
+ * Otherwise, the probes compile to nothing.
+ */
+
+#pragma once
+
+#include <string_view>
+
+#include <sharg/platform.hpp>
+
+#if SHARG_HAS_USDT
+#    include <chrono>
+#    include <cstdint>
+
+#    include <sys/sdt.h>
+
+//!\cond
+#    define SHARG_PROBE1(name, arg1) DTRACE_PROBE1(sharg, name, arg1)
+#    define SHARG_PROBE3(name, arg1, arg2, arg3) DTRACE_PROBE3(sharg, name, arg1, arg2, arg3)
+//!\endcond
+#else
+//!\cond
+#    define SHARG_PROBE1(name, arg1)
+#    define SHARG_PROBE3(name, arg1, arg2, arg3)
+//!\endcond
+#endif
+
+namespace sharg::detail
+{
+
+/*!\brief Fires the probes `validator_entry` on construction and `validator_exit` on destruction.
+ * \ingroup misc
+ * \details
+ * Is empty and does nothing if `SHARG_HAS_USDT` is not set.
+ */
+class validator_probe
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    validator_probe(validator_probe const &) = delete;             //!< Deleted.
+    validator_probe & operator=(validator_probe const &) = delete; //!< Deleted.
+
+#if SHARG_HAS_USDT
+    /*!\brief Fires `validator_entry`.
+     * \param[in] id The identifier of the option; must outlive the probe.
+     */
+    explicit validator_probe(std::string_view const id) noexcept : id{id}, begin{std::chrono::steady_clock::now()}
+    {
+        DTRACE_PROBE2(sharg, validator_entry, id.data(), id.size());
+    }
+
+    //!\brief Fires `validator_exit`.
+    ~validator_probe()
+    {
+        int64_t const duration =
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - begin).count();
+        DTRACE_PROBE3(sharg, validator_exit, id.data(), id.size(), duration);
+    }
+#else
+    //!\brief Does nothing.
+    explicit constexpr validator_probe(std::string_view const) noexcept
+    {}
+#endif
+    //!\}
+
+#if SHARG_HAS_USDT
+private:
+    std::string_view id;                           //!< The identifier of the option.
+    std::chrono::steady_clock::time_point begin{}; //!< The time of `validator_entry`.
+#endif
+};
+
+} // namespace sharg::detail
@@ -0,0 +1,453 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \author Enrico Seiler <enrico.seiler AT fu-berlin.de>
+ * \brief Provides sharg::detail::response_file_expander and its helpers.
+ */
+
+#pragma once
+
+#ifndef _WIN32
+#    include <fcntl.h>
+#    include <unistd.h>
+
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#else
+#    include <fstream>
+#    include <iterator>
+#endif
+
+#include <algorithm>
+#include <deque>
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <sharg/auxiliary.hpp>
+#include <sharg/exceptions.hpp>
+
+namespace sharg::detail
+{
+
+/*!\brief Provides the contents of a file as read-only memory.
+ * \ingroup parser
+ *
+ * \details
+ *
+ * Regular files are memory-mapped, i.e. their contents are not copied. Other files, e.g. pipes as created by a
+ * process substitution `@<(ls *.fa)`, are read into a buffer. On Windows, all files are read into a buffer.
+ *
+ * The address of the contents does not change when a mapped_file is moved.
+ */
+class mapped_file
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    mapped_file() = default;                                //!< Defaulted.
+    mapped_file(mapped_file const &) = delete;              //!< Deleted.
+    mapped_file & operator=(mapped_file const &) = delete;  //!< Deleted.
+
+    //!\brief Move constructor. The moved-from object is empty.
+    mapped_file(mapped_file && other) noexcept :
+        mapping{std::exchange(other.mapping, nullptr)},
+        mapping_size{std::exchange(other.mapping_size, 0u)},
+        buffer{std::exchange(other.buffer, {})}
+    {}
+
+    //!\brief Move assignment. The moved-from object is empty.
+    mapped_file & operator=(mapped_file && other) noexcept
+    {
+        std::swap(mapping, other.mapping);
+        std::swap(mapping_size, other.mapping_size);
+        std::swap(buffer, other.buffer);
+        return *this;
+    }
+
+    //!\brief Unmaps the file.
+    ~mapped_file()
+    {
+#ifndef _WIN32
+        if (mapping != nullptr)
+            ::munmap(mapping, mapping_size);
+#endif
+    }
+
+    /*!\brief Maps the given file.
+     * \param[in] path The path of the file.
+     * \throws sharg::user_input_error if the file cannot be opened or read.
+     */
+    explicit mapped_file(std::filesystem::path const & path)
+    {
+#ifndef _WIN32
+        int const fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+
+        if (fd == -1)
+            throw user_input_error{"Could not open the response file " + path.string() + "."};
+
+        struct stat file_status{};
+        bool success = ::fstat(fd, &file_status) == 0 && !S_ISDIR(file_status.st_mode);
+
+        if (success && S_ISREG(file_status.st_mode))
+        {
+            if (file_status.st_size > 0)
+            {
+                void * const memory = ::mmap(nullptr, file_status.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+                success = memory != MAP_FAILED;
+
+                if (success)
+                {
+                    mapping = memory;
+                    mapping_size = file_status.st_size;
+                    ::madvise(mapping, mapping_size, MADV_SEQUENTIAL);
+                }
+            }
+        }
+        else if (success) // e.g. a pipe, which cannot be mapped
+        {
+            char chunk[4096];
+            ssize_t count{};
+
+            while ((count = ::read(fd, chunk, sizeof(chunk))) > 0)
+                buffer.insert(buffer.end(), chunk, chunk + count);
+
+            success = count == 0;
+        }
+
+        ::close(fd);
+
+        if (!success)
+            throw user_input_error{"Could not read the response file " + path.string() + "."};
+#else
+        std::ifstream file{path, std::ios::binary};
+
+        if (!file.is_open() || std::filesystem::is_directory(path))
+            throw user_input_error{"Could not open the response file " + path.string() + "."};
+
+        buffer.assign(std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{});
+#endif
+    }
+    //!\}
+
+    //!\brief Returns the contents of the file.
+    std::string_view contents() const noexcept
+    {
+        if (mapping != nullptr)
+            return {static_cast<char const *>(mapping), mapping_size};
+
+        return {buffer.data(), buffer.size()};
+    }
+
+private:
+    //!\brief The memory-mapped file contents. `nullptr` if the file is empty or was read into mapped_file::buffer.
+    void * mapping{nullptr};
+    //!\brief The size of mapped_file::mapping.
+    size_t mapping_size{};
+    //!\brief The file contents if the file could not be mapped. A std::vector keeps its address when moved.
+    std::vector<char> buffer{};
+};
+
+/*!\brief Splits the contents of a response file into arguments, one argument at a time.
+ * \ingroup parser
+ *
+ * \details
+ *
+ * Arguments are returned as views on the file contents whenever possible. Only arguments that need to be rewritten,
+ * i.e. quoted or escaped arguments in sharg::response_file_mode::shell, are stored in the given storage.
+ *
+ * In sharg::response_file_mode::shell, arguments are separated by whitespace. Characters enclosed in single quotes
+ * are taken literally. Within double quotes, a backslash only escapes `"`, `\`, `$`, `` ` `` and a newline.
+ * Outside of quotes, a backslash escapes any character. A backslash followed by a newline continues the line.
+ */
+class response_file_tokenizer
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    response_file_tokenizer() = delete; //!< Deleted.
+
+    /*!\brief Constructs the tokenizer.
+     * \param[in] contents  The contents of the response file.
+     * \param[in] mode      How to split the contents; must not be sharg::response_file_mode::off.
+     * \param[in] rewritten Stores arguments that are not a substring of `contents`.
+     * \param[in] file_name The name of the response file used in error messages.
+     */
+    response_file_tokenizer(std::string_view const contents,
+                            response_file_mode const mode,
+                            std::deque<std::string> & rewritten,
+                            std::string_view const file_name) :
+        contents{contents},
+        mode{mode},
+        rewritten{rewritten},
+        file_name{file_name}
+    {}
+    //!\}
+
+    /*!\brief Returns the next argument.
+     * \returns The next argument or std::nullopt if all arguments were returned.
+     * \throws sharg::user_input_error if a quote is not terminated.
+     */
+    std::optional<std::string_view> next()
+    {
+        switch (mode)
+        {
+            case response_file_mode::newline:
+                return next_delimited('\n');
+            case response_file_mode::null:
+                return next_delimited('\0');
+            case response_file_mode::shell:
+                return next_shell_word();
+            default:
+                return std::nullopt;
+        }
+    }
+
+private:
+    //!\brief Returns the next non-empty argument that is terminated by `delimiter` or the end of the file.
+    std::optional<std::string_view> next_delimited(char const delimiter)
+    {
+        while (position < contents.size())
+        {
+            size_t const end = std::min(contents.find(delimiter, position), contents.size());
+            std::string_view argument = contents.substr(position, end - position);
+            position = end + 1u;
+
+            if (delimiter == '\n' && argument.ends_with('\r')) // Windows line endings
+                argument.remove_suffix(1u);
+
+            if (!argument.empty())
+                return argument;
+        }
+
+        return std::nullopt;
+    }
+
+    //!\brief Returns the next whitespace separated argument, removing quotes and escapes.
+    std::optional<std::string_view> next_shell_word()
+    {
+        // A line continuation before an argument separates arguments like whitespace.
+        while (position < contents.size())
+        {
+            if (is_space(contents[position]))
+                ++position;
+            else if (contents.substr(position).starts_with("\\\n"))
+                position += 2u;
+            else
+                break;
+        }
+
+        if (position == contents.size())
+            return std::nullopt;
+
+        size_t const start = position;
+        std::string * word{nullptr}; // Only set if the argument is not a substring of the contents.
+
+        // Copies the contents read so far, once the first quote or escape is found.
+        auto rewrite = [&]()
+        {
+            if (word == nullptr)
+                word = &rewritten.emplace_back(contents.substr(start, position - start));
+        };
+
+        while (position < contents.size() && !is_space(contents[position]))
+        {
+            char const c = contents[position];
+
+            if (c == '\'')
+            {
+                rewrite();
+                size_t const end = contents.find('\'', position + 1u);
+
+                if (end == std::string_view::npos)
+                    throw_unterminated_quote();
+
+                word->append(contents.substr(position + 1u, end - position - 1u));
+                position = end + 1u;
+            }
+            else if (c == '"')
+            {
+                rewrite();
+
+                for (++position; position < contents.size() && contents[position] != '"'; ++position)
+                {
+                    if (contents[position] == '\\' && position + 1u < contents.size()
+                        && std::string_view{"\"\\$`\n"}.contains(contents[position + 1u]))
+                    {
+                        ++position;
+
+                        if (contents[position] == '\n') // line continuation
+                            continue;
+                    }
+
+                    word->push_back(contents[position]);
+                }
+
+                if (position == contents.size())
+                    throw_unterminated_quote();
+
+                ++position;
+            }
+            else if (c == '\\')
+            {
+                rewrite();
+
+                if (position + 1u < contents.size() && contents[position + 1u] != '\n') // not a line continuation
+                    word->push_back(contents[position + 1u]);
+
+                position += 2u;
+            }
+            else
+            {
+                if (word != nullptr)
+                    word->push_back(c);
+
+                ++position;
+            }
+        }
+
+        position = std::min(position, contents.size());
+
+        if (word != nullptr)
+            return std::string_view{*word};
+
+        return contents.substr(start, position - start);
+    }
+
+    //!\brief Whether `c` separates arguments in sharg::response_file_mode::shell.
+    static constexpr bool is_space(char const c) noexcept
+    {
+        return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\v' || c == '\f';
+    }
+
+    //!\brief Throws a sharg::user_input_error for an unterminated quote.
+    [[noreturn]] void throw_unterminated_quote() const
+    {
+        throw user_input_error{"Unterminated quote in the response file " + std::string{file_name} + "."};
+    }
+
+    //!\brief The contents of the response file.
+    std::string_view contents;
+    //!\brief The position of the next character to read.
+    size_t position{};
+    //!\brief How to split the contents.
+    response_file_mode mode;
+    //!\brief Stores arguments that are not a substring of the contents.
+    std::deque<std::string> & rewritten;
+    //!\brief The name of the response file.
+    std::string_view file_name;
+};
+
+/*!\brief Owns the memory that the arguments expanded from response files refer to.
+ * \ingroup parser
+ */
+struct response_file_storage
+{
+    std::deque<mapped_file> files{};       //!< The contents of all expanded response files.
+    std::deque<std::string> rewritten{};   //!< Arguments that are not a substring of the file contents.
+};
+
+/*!\brief Replaces each `@file` argument by the arguments contained in `file`.
+ * \ingroup parser
+ *
+ * \details
+ *
+ * Response files may contain `@file` arguments themselves, which are expanded recursively. A response file that
+ * (indirectly) includes itself is an error. Relative paths are resolved against the current working directory.
+ *
+ * The expanded arguments behave exactly like command line arguments: After `--`, which may also be contained in a
+ * response file, no further arguments are expanded. The first argument, i.e. the name of the executable, is never
+ * expanded.
+ */
+class response_file_expander
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    response_file_expander() = delete; //!< Deleted.
+
+    /*!\brief Constructs the expander.
+     * \param[in] mode    How to split the response files; must not be sharg::response_file_mode::off.
+     * \param[in] storage Stores the contents of the response files. Must outlive the expanded arguments.
+     */
+    response_file_expander(response_file_mode const mode, response_file_storage & storage) :
+        mode{mode},
+        storage{storage}
+    {}
+    //!\}
+
+    /*!\brief Expands all response files.
+     * \param[in] arguments The command line arguments.
+     * \returns The arguments with every `@file` replaced by its contents.
+     * \throws sharg::user_input_error if a response file cannot be read, includes itself or contains an
+     *         unterminated quote.
+     */
+    std::vector<std::string_view> expand(std::span<std::string_view const> const arguments)
+    {
+        std::vector<std::string_view> expanded{};
+        expanded.reserve(arguments.size());
+
+        if (!arguments.empty())
+            expanded.push_back(arguments.front()); // the executable name
+
+        for (std::string_view const argument : arguments.subspan(std::min<size_t>(1u, arguments.size())))
+            append(argument, expanded);
+
+        return expanded;
+    }
+
+private:
+    //!\brief Appends `argument`, or the arguments contained in the response file it refers to, to `expanded`.
+    void append(std::string_view const argument, std::vector<std::string_view> & expanded)
+    {
+        if (end_of_options || argument.size() < 2u || argument[0] != '@')
+        {
+            end_of_options = end_of_options || argument == "--";
+            expanded.push_back(argument);
+            return;
+        }
+
+        std::filesystem::path const path{argument.substr(1u)};
+        std::error_code error{};
+        std::filesystem::path identity = std::filesystem::weakly_canonical(path, error);
+
+        if (error)
+            identity = path;
+
+        if (std::ranges::find(open_files, identity) != open_files.end())
+            throw user_input_error{"The response file " + path.string() + " includes itself."};
+
+        std::string const file_name = path.string();
+        response_file_tokenizer tokenizer{storage.files.emplace_back(path).contents(),
+                                          mode,
+                                          storage.rewritten,
+                                          file_name};
+
+        open_files.push_back(std::move(identity));
+
+        while (std::optional<std::string_view> const token = tokenizer.next())
+            append(*token, expanded);
+
+        open_files.pop_back();
+    }
+
+    //!\brief How to split the response files.
+    response_file_mode mode;
+    //!\brief Stores the contents of the response files.
+    response_file_storage & storage;
+    //!\brief The response files that are currently expanded, i.e. the chain of nested files.
+    std::vector<std::filesystem::path> open_files{};
+    //!\brief Whether `--` was encountered.
+    bool end_of_options{false};
+};
+
+} // namespace sharg::detail
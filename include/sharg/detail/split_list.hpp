@@ -0,0 +1,130 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \author Enrico Seiler <enrico.seiler AT fu-berlin.de>
+ * \brief Provides sharg::detail::count_delimiters and sharg::detail::for_each_list_value.
+ */
+
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#if defined(__AVX2__)
+#    include <immintrin.h>
+#elif defined(__SSE2__)
+#    include <emmintrin.h>
+#endif
+
+#include <sharg/platform.hpp>
+
+namespace sharg::detail
+{
+
+/*!\brief The number of characters that sharg::detail::delimiter_mask compares at once.
+ * \ingroup parser
+ * \details
+ *
+ * 32 with AVX2, 16 with SSE2, and 8 otherwise.
+ */
+#if defined(__AVX2__)
+inline constexpr size_t delimiter_block_size = 32u;
+#elif defined(__SSE2__)
+inline constexpr size_t delimiter_block_size = 16u;
+#else
+inline constexpr size_t delimiter_block_size = 8u;
+#endif
+
+/*!\brief Compares sharg::detail::delimiter_block_size characters to the delimiter.
+ * \ingroup parser
+ * \param[in] block     Points to at least sharg::detail::delimiter_block_size characters.
+ * \param[in] delimiter The character to search for.
+ * \returns A bit mask in which bit `i` is set if `block[i] == delimiter`.
+ */
+inline uint32_t delimiter_mask(char const * const block, char const delimiter) noexcept
+{
+#if defined(__AVX2__)
+    __m256i const characters = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(block));
+    __m256i const matches = _mm256_cmpeq_epi8(characters, _mm256_set1_epi8(delimiter));
+    return static_cast<uint32_t>(_mm256_movemask_epi8(matches));
+#elif defined(__SSE2__)
+    __m128i const characters = _mm_loadu_si128(reinterpret_cast<__m128i const *>(block));
+    __m128i const matches = _mm_cmpeq_epi8(characters, _mm_set1_epi8(delimiter));
+    return static_cast<uint32_t>(_mm_movemask_epi8(matches));
+#else
+    uint32_t mask{};
+    for (size_t i = 0; i < delimiter_block_size; ++i)
+        mask |= static_cast<uint32_t>(block[i] == delimiter) << i;
+    return mask;
+#endif
+}
+
+/*!\brief Counts the occurrences of `delimiter` in `list`.
+ * \ingroup parser
+ * \param[in] list      The string to search.
+ * \param[in] delimiter The character to count.
+ * \returns The number of delimiters; the list consists of one more value.
+ */
+inline size_t count_delimiters(std::string_view const list, char const delimiter) noexcept
+{
+    char const * const data = list.data();
+    size_t const size = list.size();
+    size_t count{};
+    size_t i{};
+
+    for (; i + delimiter_block_size <= size; i += delimiter_block_size)
+        count += std::popcount(delimiter_mask(data + i, delimiter));
+
+    for (; i < size; ++i)
+        count += data[i] == delimiter;
+
+    return count;
+}
+
+/*!\brief Calls `callback` with each value of a delimiter-separated list, in order.
+ * \ingroup parser
+ * \tparam callback_t The type of the callback; must be invocable with a std::string_view.
+ * \param[in] list      The delimiter-separated list, e.g. "1,2,3".
+ * \param[in] delimiter The character separating the values, e.g. ','.
+ * \param[in] callback  Called with a view of each value; the views point into `list`.
+ *
+ * \details
+ *
+ * The delimiters are found sharg::detail::delimiter_block_size characters at a time. A list with `n` delimiters
+ * consists of `n + 1` values, some of which may be empty, e.g. "1,,2" and "".
+ */
+template <typename callback_t>
+inline void for_each_list_value(std::string_view const list, char const delimiter, callback_t && callback)
+{
+    char const * const data = list.data();
+    size_t const size = list.size();
+    size_t begin{};
+    size_t i{};
+
+    for (; i + delimiter_block_size <= size; i += delimiter_block_size)
+    {
+        for (uint32_t mask = delimiter_mask(data + i, delimiter); mask != 0u; mask &= mask - 1u)
+        {
+            size_t const end = i + std::countr_zero(mask);
+            callback(std::string_view{data + begin, end - begin});
+            begin = end + 1u;
+        }
+    }
+
+    for (; i < size; ++i)
+    {
+        if (data[i] == delimiter)
+        {
+            callback(std::string_view{data + begin, i - begin});
+            begin = i + 1u;
+        }
+    }
+
+    callback(std::string_view{data + begin, size - begin});
+}
+
+} // namespace sharg::detail
@@ -25,9 +25,10 @@ static std::string const supported_exports =
     "[html, man]";
 #endif
 
-//!\brief Concept for views whose value type is ostreamable.
+//!\brief Concept for views whose value type is ostreamable and that are not streamed as a whole, e.g. std::string_view.
 template <typename container_t>
-concept is_ostreamable_view = std::ranges::view<container_t> && ostreamable<std::ranges::range_value_t<container_t>>;
+concept is_ostreamable_view = std::ranges::view<container_t> && ostreamable<std::ranges::range_value_t<container_t>>
+                           && !requires (std::ostream & stream, container_t const & view) { stream << view; };
 
 /*!\brief Streams all parameters via std::ostringstream and returns a concatenated string.
  * \ingroup misc
@@ -0,0 +1,276 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \author Enrico Seiler <enrico.seiler AT fu-berlin.de>
+ * \brief Provides sharg::detail::trace_recorder and sharg::detail::trace_span.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include <sharg/platform.hpp>
+
+namespace sharg::detail
+{
+
+/*!\brief Records the duration of the phases of the sharg::parser and writes them as Chrome trace.
+ * \ingroup misc
+ *
+ * \details
+ *
+ * Tracing is enabled by setting the environment variable `SHARG_TRACE` to the path of the output file, e.g.
+ * `SHARG_TRACE=trace.json ./app`. The events are written when the program exits, including exits via `std::exit`,
+ * and can be opened with `chrome://tracing` or https://ui.perfetto.dev.
+ *
+ * If tracing is disabled, recording an event only checks a flag. If it is enabled, the memory for the events is
+ * allocated once; recording an event does not allocate. Events beyond sharg::detail::trace_recorder::capacity are
+ * dropped.
+ */
+class trace_recorder
+{
+public:
+    //!\brief The maximal number of recorded events.
+    static constexpr size_t capacity{4096};
+
+    //!\brief The maximal length of the label of an event. Longer labels are truncated.
+    static constexpr size_t label_capacity{47};
+
+    //!\brief A completed phase.
+    struct event
+    {
+        char const * name{};                      //!< The name of the phase; a string literal.
+        std::array<char, label_capacity> label{}; //!< The label, e.g. the option identifier.
+        uint8_t label_size{};                     //!< The length of the label.
+        int64_t begin{};                          //!< The start in nanoseconds since the recorder started.
+        int64_t end{};                            //!< The end in nanoseconds since the recorder started.
+    };
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    trace_recorder(trace_recorder const &) = delete;             //!< Deleted.
+    trace_recorder & operator=(trace_recorder const &) = delete; //!< Deleted.
+
+    /*!\brief Enables tracing if `path` is neither `nullptr` nor empty.
+     * \param[in] path The path of the output file.
+     */
+    explicit trace_recorder(char const * const path)
+    {
+        if (path == nullptr || *path == '\0')
+            return;
+
+        output_path = path;
+        events = std::make_unique<event[]>(capacity);
+        origin = std::chrono::steady_clock::now();
+        is_enabled = true;
+    }
+
+    //!\brief Writes the recorded events.
+    ~trace_recorder()
+    {
+        write();
+    }
+    //!\}
+
+    //!\brief Returns the recorder of the program, which is configured by the environment variable `SHARG_TRACE`.
+    static trace_recorder & instance()
+    {
+        static trace_recorder recorder{std::getenv("SHARG_TRACE")};
+        return recorder;
+    }
+
+    //!\brief Whether events are recorded.
+    bool enabled() const noexcept
+    {
+        return is_enabled;
+    }
+
+    //!\brief Returns the current time in nanoseconds since the recorder started; `0` if tracing is disabled.
+    int64_t now() const noexcept
+    {
+        if (!is_enabled)
+            return 0;
+
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - origin).count();
+    }
+
+    /*!\brief Records a completed phase. Does nothing if tracing is disabled.
+     * \param[in] name  The name of the phase; must be a string literal.
+     * \param[in] label The label of the phase, e.g. the option identifier; is copied.
+     * \param[in] begin The start of the phase as returned by sharg::detail::trace_recorder::now.
+     * \details
+     * May be called concurrently.
+     */
+    void record(char const * const name, std::string_view const label, int64_t const begin) noexcept
+    {
+        if (!is_enabled)
+            return;
+
+        int64_t const end = now();
+        size_t const position = size.fetch_add(1u, std::memory_order_relaxed);
+
+        if (position >= capacity)
+            return;
+
+        event & current = events[position];
+        current.name = name;
+        current.label_size = static_cast<uint8_t>(std::min(label.size(), label_capacity));
+        std::ranges::copy_n(label.data(), current.label_size, current.label.data());
+        current.begin = begin;
+        current.end = end;
+    }
+
+    /*!\brief Writes all events recorded so far to the output file.
+     * \details
+     * The file is overwritten by every call. Must not be called concurrently with
+     * sharg::detail::trace_recorder::record. Errors are ignored; tracing must never affect the application.
+     */
+    void write() const
+    {
+        if (!is_enabled)
+            return;
+
+        size_t const count = std::min(size.load(), capacity);
+        std::string json{"{\"displayTimeUnit\":\"ns\",\"traceEvents\":["};
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            event const & current = events[i];
+
+            if (i != 0u)
+                json += ',';
+
+            json += "\n{\"name\":\"";
+            append_escaped(json, current.name);
+            json += "\",\"cat\":\"sharg\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":";
+            append_microseconds(json, current.begin);
+            json += ",\"dur\":";
+            append_microseconds(json, current.end - current.begin);
+
+            if (current.label_size != 0u)
+            {
+                json += ",\"args\":{\"id\":\"";
+                append_escaped(json, std::string_view{current.label.data(), current.label_size});
+                json += "\"}";
+            }
+
+            json += '}';
+        }
+
+        json += "\n]}\n";
+
+        if (std::FILE * const file = std::fopen(output_path.c_str(), "w"))
+        {
+            std::fwrite(json.data(), 1u, json.size(), file);
+            std::fclose(file);
+        }
+    }
+
+private:
+    //!\brief Whether events are recorded.
+    bool is_enabled{false};
+    //!\brief The path of the output file.
+    std::string output_path{};
+    //!\brief The time at which the recorder started.
+    std::chrono::steady_clock::time_point origin{};
+    //!\brief The storage for the events; allocated once if tracing is enabled.
+    std::unique_ptr<event[]> events{};
+    //!\brief The number of recorded events, including dropped ones.
+    std::atomic<size_t> size{};
+
+    //!\brief Appends `value` as content of a JSON string.
+    static void append_escaped(std::string & json, std::string_view const value)
+    {
+        for (char const c : value)
+        {
+            if (c == '"' || c == '\\')
+            {
+                json += '\\';
+                json += c;
+            }
+            else if (static_cast<unsigned char>(c) < 0x20)
+            {
+                std::array<char, 7> buffer{};
+                std::snprintf(buffer.data(), buffer.size(), "\\u%04x", static_cast<unsigned>(c));
+                json += buffer.data();
+            }
+            else
+            {
+                json += c;
+            }
+        }
+    }
+
+    //!\brief Appends nanoseconds as microseconds, the unit of the Chrome trace format.
+    static void append_microseconds(std::string & json, int64_t const nanoseconds)
+    {
+        std::array<char, 32> buffer{};
+        std::snprintf(buffer.data(),
+                      buffer.size(),
+                      "%lld.%03lld",
+                      static_cast<long long>(nanoseconds / 1000),
+                      static_cast<long long>(nanoseconds % 1000));
+        json += buffer.data();
+    }
+};
+
+/*!\brief Records the lifetime of the object as phase in sharg::detail::trace_recorder::instance.
+ * \ingroup misc
+ *
+ * \details
+ *
+ * ```cpp
+ * {
+ *     detail::trace_span span{"parse_format"};
+ *     parse_format();
+ * }
+ * ```
+ */
+class trace_span
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    trace_span(trace_span const &) = delete;             //!< Deleted.
+    trace_span & operator=(trace_span const &) = delete; //!< Deleted.
+
+    /*!\brief Starts the phase.
+     * \param[in] name  The name of the phase; must be a string literal.
+     * \param[in] label The label of the phase, e.g. the option identifier; must outlive the span.
+     */
+    explicit trace_span(char const * const name, std::string_view const label = {}) noexcept :
+        recorder{trace_recorder::instance().enabled() ? &trace_recorder::instance() : nullptr},
+        name{name},
+        label{label},
+        begin{recorder ? recorder->now() : 0}
+    {}
+
+    //!\brief Records the phase.
+    ~trace_span()
+    {
+        if (recorder)
+            recorder->record(name, label, begin);
+    }
+    //!\}
+
+private:
+    trace_recorder * recorder; //!< The recorder; `nullptr` if tracing is disabled.
+    char const * name;         //!< The name of the phase.
+    std::string_view label;    //!< The label of the phase.
+    int64_t begin;             //!< The start of the phase.
+};
+
+} // namespace sharg::detail
@@ -0,0 +1,1003 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \author Enrico Seiler <enrico.seiler AT fu-berlin.de>
+ * \brief Provides sharg::detail::value_parser.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <chrono>
+#include <limits>
+#include <ratio>
+#include <span>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include <sharg/std/charconv>
+
+#include <sharg/concept.hpp>
+#include <sharg/detail/concept.hpp>
+#include <sharg/detail/format_base.hpp>
+#include <sharg/detail/parallel_validation.hpp>
+#include <sharg/detail/probe.hpp>
+#include <sharg/detail/split_list.hpp>
+#include <sharg/detail/trace.hpp>
+#include <sharg/enumeration_table.hpp>
+
+namespace sharg::detail
+{
+
+/*!\brief Parses, validates and reports the values given for options; shared by the parse formats.
+ * \ingroup parser
+ *
+ * \details
+ *
+ * Provides the conversion of command line arguments into option values and the retrieval of the values recorded
+ * for an option, including the respective error messages. Used by sharg::detail::format_parse and
+ * sharg::static_schema, such that both accept the same values and report the same errors.
+ *
+ * \remark For a complete overview, take a look at \ref parser
+ */
+class value_parser : public format_base
+{
+protected:
+    //!\brief Describes the result of parsing the user input string given the respective option value type.
+    enum class option_parse_result : uint8_t
+    {
+        success,       //!< Parsing of user input was successful.
+        error,         //!< There was some error while trying to parse the user input.
+        overflow_error //!< Parsing was successful but the arithmetic value would cause an overflow.
+    };
+
+    //!\brief A value given for an option on the command line.
+    struct option_occurrence
+    {
+        std::string_view value{}; //!< The value given for the option, pointing into the command line arguments.
+        bool by_short_id{};       //!< Whether the option was specified by its short identifier.
+        bool missing_value{};     //!< Whether the option was specified without a value, e.g. `-i=`.
+    };
+
+    //!\brief Whether an identifier given on the command line belongs to an option or a flag.
+    enum class id_kind : uint8_t
+    {
+        none,   //!< The identifier is not registered.
+        option, //!< The identifier belongs to an option.
+        flag    //!< The identifier belongs to a flag.
+    };
+
+    //!\brief The positional arguments of a command line and the progress of retrieving them.
+    struct positional_state
+    {
+        //!\brief The arguments that are neither identifiers nor option values.
+        std::vector<std::string_view> arguments{};
+        //!\brief The position of the next positional argument to be retrieved.
+        size_t next_argument{};
+        //!\brief The number of the current positional option, used in error messages.
+        unsigned option_number{};
+    };
+
+    /*!\brief Appends a double dash to a long identifier and returns it.
+    * \param[in] long_id The name of the long identifier.
+    * \returns The input long name prepended with a double dash.
+    */
+    static std::string prepend_dash(std::string const & long_id)
+    {
+        return {"--" + long_id};
+    }
+
+    /*!\brief Appends a double dash to a short identifier and returns it.
+    * \param[in] short_id The name of the short identifier.
+    * \returns The input short name prepended with a single dash.
+    */
+    static std::string prepend_dash(char const short_id)
+    {
+        return {'-', short_id};
+    }
+
+    /*!\brief Returns "-[short_id]/--[long_id]" if both are non-empty or just one of them if the other is empty.
+    * \param[in] short_id The name of the short identifier.
+    * \param[in] long_id  The name of the long identifier.
+    * \returns The short_id prepended with a single dash and the long_id prepended with a double dash, separated by '/'.
+    */
+    static std::string combine_option_names(char const short_id, std::string const & long_id)
+    {
+        if (short_id == '\0')
+            return prepend_dash(long_id);
+        else if (long_id.empty())
+            return prepend_dash(short_id);
+        else // both are set (note: both cannot be empty, this is caught before)
+            return prepend_dash(short_id) + "/" + prepend_dash(long_id);
+    }
+
+    /*!\brief Tries to parse an input string into a value using the stream `operator>>`.
+     * \tparam option_t Must model sharg::istreamable.
+     * \param[out] value Stores the parsed value.
+     * \param[in] in The input argument to be parsed.
+     * \returns sharg::option_parse_result::error if `in` could not be parsed via the stream
+     *          operator and otherwise sharg::option_parse_result::success.
+     *
+     * \details
+     *
+     * This is the fallback for types that are neither arithmetic, nor named enumerations, nor constructible from
+     * a std::string_view, and that do not customise sharg::custom::parsing::from_chars.
+     */
+    template <typename option_t>
+        requires istreamable<option_t> && (!std::is_arithmetic_v<option_t>) && (!has_custom_from_chars<option_t>)
+              && (!string_view_constructible_option<option_t>)
+    static option_parse_result parse_option_value(option_t & value, std::string_view const in)
+    {
+        std::istringstream stream{std::string{in}};
+        stream >> value;
+
+        if (stream.fail() || !stream.eof())
+            return option_parse_result::error;
+
+        return option_parse_result::success;
+    }
+
+    /*!\brief Parses an input string into a value via sharg::custom::parsing<option_t>::from_chars.
+     * \tparam option_t Must model sharg::detail::has_custom_from_chars.
+     * \param[out] value Stores the parsed value.
+     * \param[in] in The input argument to be parsed.
+     * \returns sharg::option_parse_result::success if `from_chars` returns `std::errc{}`,
+     *          sharg::option_parse_result::overflow_error if it returns `std::errc::result_out_of_range`,
+     *          and otherwise sharg::option_parse_result::error.
+     */
+    template <has_custom_from_chars option_t>
+    static option_parse_result parse_option_value(option_t & value, std::string_view const in)
+    {
+        std::errc const ec = sharg::custom::parsing<option_t>::from_chars(in, value);
+
+        if (ec == std::errc::result_out_of_range)
+            return option_parse_result::overflow_error;
+        else if (ec != std::errc{})
+            return option_parse_result::error;
+
+        return option_parse_result::success;
+    }
+
+    /*!\brief Constructs the value from the input string, e.g. a std::filesystem::path.
+     * \tparam option_t Must model sharg::detail::string_view_constructible_option.
+     * \param[out] value Stores the parsed value.
+     * \param[in] in The input argument to be parsed.
+     * \returns sharg::option_parse_result::success.
+     *
+     * \details
+     *
+     * The argument is used as is. In contrast to the stream `operator>>` of std::filesystem::path, a path
+     * containing spaces is accepted and quotes are not removed; the shell already did this.
+     */
+    template <string_view_constructible_option option_t>
+    static option_parse_result parse_option_value(option_t & value, std::string_view const in)
+    {
+        value = option_t(in);
+        return option_parse_result::success;
+    }
+
+    /*!\brief Tries to parse an input string into a std::chrono::duration, e.g. "250", "250ms" or "2min".
+     * \tparam rep_t The arithmetic type of the duration's count.
+     * \tparam period_t The std::ratio of the duration's unit.
+     * \param[out] value Stores the parsed value.
+     * \param[in] in The input argument to be parsed.
+     * \returns sharg::option_parse_result::error if `in` is not a number optionally followed by a unit, or if the
+     *          number of units is not representable by the duration, sharg::option_parse_result::overflow_error if
+     *          the duration would overflow, and otherwise sharg::option_parse_result::success.
+     *
+     * \details
+     *
+     * A number without unit counts ticks of the duration. Supported units are "ns", "us", "ms", "s", "min", "h"
+     * and "d". For example, "2s" is valid for std::chrono::milliseconds, but "1500ms" is invalid for
+     * std::chrono::seconds.
+     */
+    template <typename rep_t, typename period_t>
+        requires (!has_custom_from_chars<std::chrono::duration<rep_t, period_t>>)
+    static option_parse_result parse_option_value(std::chrono::duration<rep_t, period_t> & value,
+                                                  std::string_view const in)
+    {
+        rep_t count{};
+        auto res = std::from_chars(in.data(), in.data() + in.size(), count);
+
+        if (res.ec == std::errc::result_out_of_range)
+            return option_parse_result::overflow_error;
+        else if (res.ec == std::errc::invalid_argument)
+            return option_parse_result::error;
+
+        std::string_view const unit{res.ptr, in.data() + in.size()};
+
+        if (unit.empty())
+            return convert_duration<period_t>(value, count);
+        else if (unit == "ns")
+            return convert_duration<std::nano>(value, count);
+        else if (unit == "us")
+            return convert_duration<std::micro>(value, count);
+        else if (unit == "ms")
+            return convert_duration<std::milli>(value, count);
+        else if (unit == "s")
+            return convert_duration<std::ratio<1>>(value, count);
+        else if (unit == "min")
+            return convert_duration<std::ratio<60>>(value, count);
+        else if (unit == "h")
+            return convert_duration<std::ratio<3600>>(value, count);
+        else if (unit == "d")
+            return convert_duration<std::ratio<86400>>(value, count);
+
+        return option_parse_result::error;
+    }
+
+    /*!\brief Stores `count` ticks of `unit_period` in `value` if this is possible without loss or overflow.
+     * \tparam unit_period The std::ratio of the given unit.
+     * \tparam rep_t The arithmetic type of the duration's count.
+     * \tparam period_t The std::ratio of the duration's unit.
+     * \param[out] value Stores the converted duration.
+     * \param[in] count The number of ticks of the given unit.
+     * \returns A sharg::option_parse_result whether the conversion was successful or not.
+     */
+    template <typename unit_period, typename rep_t, typename period_t>
+    static option_parse_result convert_duration(std::chrono::duration<rep_t, period_t> & value, rep_t const count)
+    {
+        using factor = std::ratio_divide<unit_period, period_t>;
+
+        if constexpr (std::is_floating_point_v<rep_t>)
+        {
+            value = std::chrono::duration<rep_t, period_t>{count * static_cast<rep_t>(factor::num) / factor::den};
+        }
+        else
+        {
+            if (count % factor::den != 0) // e.g. 1500ms as seconds
+                return option_parse_result::error;
+
+            auto const quotient = count / factor::den;
+
+            if (std::cmp_greater(quotient, std::numeric_limits<rep_t>::max() / factor::num)
+                || std::cmp_less(quotient, std::numeric_limits<rep_t>::min() / factor::num))
+                return option_parse_result::overflow_error;
+
+            value = std::chrono::duration<rep_t, period_t>{static_cast<rep_t>(quotient * factor::num)};
+        }
+
+        return option_parse_result::success;
+    }
+
+    /*!\brief Sets an option value depending on the keys found in sharg::enumeration_names<option_t>.
+     * \tparam option_t Must model sharg::named_enumeration.
+     * \param[out] value Stores the parsed value.
+     * \param[in] in The input argument to be parsed.
+     * \throws sharg::user_input_error if `in` is not a key in sharg::enumeration_names<option_t>.
+     * \returns sharg::option_parse_result::success.
+     */
+    template <named_enumeration option_t>
+        requires (!has_custom_from_chars<option_t>)
+    static option_parse_result parse_option_value(option_t & value, std::string_view const in)
+    {
+        auto const & map = sharg::enumeration_names<option_t>;
+
+        // A std::unordered_map<std::string, option_t> has no heterogeneous lookup.
+        auto find_key = [&map](std::string_view const key)
+        {
+            if constexpr (requires { map.find(key); })
+                return map.find(key);
+            else
+                return map.find(std::string{key});
+        };
+
+        if (auto it = find_key(in); it == map.end())
+        {
+            auto list_keys = [](auto const & key_value_pairs)
+            {
+                std::string result{'['};
+                for (auto const & [key, value] : key_value_pairs)
+                    result += std::string{key} + ", ";
+                result.replace(result.size() - 2, 2, "]"); // replace last ", " by "]"
+                return result;
+            };
+
+            std::string keys{};
+
+            if constexpr (is_enumeration_table<std::remove_cvref_t<decltype(map)>>) // already ordered by value
+            {
+                keys = list_keys(map);
+            }
+            else
+            {
+                std::vector<std::pair<std::string_view, option_t>> key_value_pairs(map.begin(), map.end());
+
+                std::sort(key_value_pairs.begin(),
+                          key_value_pairs.end(),
+                          [](auto pair1, auto pair2)
+                          {
+                              if constexpr (std::totally_ordered<option_t>)
+                              {
+                                  if (pair1.second != pair2.second)
+                                      return pair1.second < pair2.second;
+                              }
+
+                              return pair1.first < pair2.first;
+                          }); // needed for deterministic output when using unordered maps
+
+                keys = list_keys(key_value_pairs);
+            }
+
+            throw user_input_error{"You have chosen an invalid input value: " + std::string{in}
+                                   + ". Please use one of: " + keys};
+        }
+        else
+        {
+            value = it->second;
+        }
+
+        return option_parse_result::success;
+    }
+
+    //!\cond
+    static option_parse_result parse_option_value(std::string & value, std::string_view const in)
+    {
+        value = in;
+        return option_parse_result::success;
+    }
+    //!\endcond
+
+    /*!\brief Appends a copy of the input string to a sharg::string_pool.
+     * \tparam option_t Must model sharg::detail::string_pool_option.
+     * \param[out] value The pool that stores the value.
+     * \param[in] in The input argument to be appended.
+     * \returns sharg::option_parse_result::success.
+     */
+    template <string_pool_option option_t>
+    static option_parse_result parse_option_value(option_t & value, std::string_view const in)
+    {
+        value.push_back(in);
+        return option_parse_result::success;
+    }
+
+    /*!\brief Parses the given option value and appends it to the target container.
+     * \tparam container_option_t Must model sharg::detail::is_container_option and
+     *                            its value_type must be parseable via parse_option_value
+     * \tparam value_parser_t Needed to make the function "dependent" (i.e. do instantiation in the second phase of
+     *                        two-phase lookup) as the requires clause needs to be able to access the other
+     *                        parse_option_value overloads.
+     *
+     * \param[out] value The container that stores the parsed value.
+     * \param[in] in The input argument to be parsed.
+     * \returns A sharg::option_parse_result whether parsing was successful or not.
+     */
+    // clang-format off
+    template <detail::is_container_option container_option_t, typename value_parser_t = value_parser>
+        requires requires (typename container_option_t::value_type & container_value, std::string_view const in)
+        {
+            {value_parser_t::parse_option_value(container_value, in)} -> std::same_as<option_parse_result>;
+        }
+    // clang-format on
+    static option_parse_result parse_option_value(container_option_t & value, std::string_view const in)
+    {
+        typename container_option_t::value_type tmp{};
+
+        auto res = parse_option_value(tmp, in);
+
+        if (res == option_parse_result::success)
+            value.push_back(tmp);
+
+        return res;
+    }
+
+    /*!\brief Tries to parse an input string into an arithmetic value.
+     * \tparam option_t The option value type; must model std::is_arithmetic_v.
+     * \param[out] value Stores the parsed value.
+     * \param[in] in The input argument to be parsed.
+     * \returns sharg::option_parse_result::error if `in` could not be parsed to an arithmetic type
+     *          via std::from_chars, sharg::option_parse_result::overflow_error if `in` could be parsed but the
+     *          value is too large for the respective type, and otherwise sharg::option_parse_result::success.
+     *
+     * \details
+     *
+     * This function delegates to std::from_chars.
+     */
+    template <typename option_t>
+        requires std::is_arithmetic_v<option_t> && istreamable<option_t> && (!has_custom_from_chars<option_t>)
+    static option_parse_result parse_option_value(option_t & value, std::string_view const in)
+    {
+        auto res = std::from_chars(in.data(), in.data() + in.size(), value);
+
+        if (res.ec == std::errc::result_out_of_range)
+            return option_parse_result::overflow_error;
+        else if (res.ec == std::errc::invalid_argument || res.ptr != in.data() + in.size())
+            return option_parse_result::error;
+
+        return option_parse_result::success;
+    }
+
+    /*!\brief Tries to parse an input string into a boolean value.
+     * \param[out] value Stores the parsed value.
+     * \param[in] in The input argument to be parsed.
+     * \returns A sharg::option_parse_result whether parsing was successful or not.
+     *
+     * \details
+     *
+     * This function accepts the strings "0" or "false" which sets sets `value` to `false` or "1" or "true" which
+     * sets `value` to `true`.
+     */
+    static option_parse_result parse_option_value(bool & value, std::string_view const in)
+    {
+        if (in == "0" || in == "false")
+            value = false;
+        else if (in == "1" || in == "true")
+            value = true;
+        else
+            return option_parse_result::error;
+
+        return option_parse_result::success;
+    }
+
+    /*!\brief Tries to parse an input string into boolean value.
+     * \param[in] res A result value of parsing an input string to the respective option value type.
+     * \param[in] option_name The name of the option whose input was parsed.
+     * \param[in] input_value The original user input in question.
+     *
+     * \throws sharg::user_input_error if `res` was not sharg::option_parse_result::success.
+     */
+    template <typename option_type>
+    static void throw_on_input_error(option_parse_result const res,
+                                     std::string const & option_name,
+                                     std::string_view const input_value)
+    {
+        std::string msg{"Value parse failed for " + option_name + ": "};
+
+        if (res == option_parse_result::error)
+        {
+            throw user_input_error{msg + "Argument " + std::string{input_value} + " could not be parsed as type "
+                                   + get_type_name_as_string<option_type>() + "."};
+        }
+
+        if (res == option_parse_result::overflow_error)
+        {
+            if constexpr (std::is_arithmetic_v<option_type>)
+            {
+                throw user_input_error{msg + "Numeric argument " + std::string{input_value}
+                                       + " is not in the valid range ["
+                                       + std::to_string(std::numeric_limits<option_type>::min()) + ","
+                                       + std::to_string(std::numeric_limits<option_type>::max()) + "]."};
+            }
+            else
+            {
+                throw user_input_error{msg + "Argument " + std::string{input_value}
+                                       + " is not in the valid range of type "
+                                       + get_type_name_as_string<option_type>() + "."};
+            }
+        }
+
+        assert(res == option_parse_result::success); // if nothing was thrown, the result must have been a success
+    }
+
+    /*!\brief Parses the value recorded for an option.
+     *
+     * \param[out] value      Stores the recorded value, parsed by parse_option_value.
+     * \param[in]  occurrence The recorded value.
+     * \param[in]  id         The option identifier supplied on the command line.
+     *
+     * \throws sharg::too_few_arguments if the option was not followed by a value.
+     * \throws sharg::user_input_error if the given option value was invalid.
+     */
+    template <typename option_type, typename id_type>
+    static void identify_and_retrieve_option_value(option_type & value,
+                                                   option_occurrence const & occurrence,
+                                                   id_type const & id)
+    {
+        if (occurrence.missing_value)
+            throw too_few_arguments("Missing value for option " + prepend_dash(id));
+
+        auto res = parse_option_value(value, occurrence.value);
+
+        if (res != option_parse_result::success)
+            throw_on_input_error<option_type>(res, prepend_dash(id), occurrence.value);
+    }
+
+    /*!\brief Parses the value or, if the option has a list delimiter, the list recorded for a container option.
+     *
+     * \param[out] value      The container to append the parsed values to.
+     * \param[in]  occurrence The recorded value, e.g. "1" or "1,2,3".
+     * \param[in]  id         The option identifier supplied on the command line.
+     * \param[in]  delimiter  The character separating the values or `'\0'`, see sharg::config::list_delimiter.
+     *
+     * \throws sharg::too_few_arguments if the option was not followed by a value.
+     * \throws sharg::user_input_error if one of the values was invalid.
+     *
+     * \details
+     *
+     * The values of a list are parsed from views into the command line argument; see
+     * sharg::detail::for_each_list_value.
+     */
+    template <typename option_type, typename id_type>
+    static void identify_and_retrieve_container_values(option_type & value,
+                                                       option_occurrence const & occurrence,
+                                                       id_type const & id,
+                                                       char const delimiter)
+    {
+        if (delimiter == '\0')
+        {
+            identify_and_retrieve_option_value(value, occurrence, id);
+            return;
+        }
+
+        if (occurrence.missing_value)
+            throw too_few_arguments("Missing value for option " + prepend_dash(id));
+
+        for_each_list_value(occurrence.value,
+                            delimiter,
+                            [&value, &id](std::string_view const element)
+                            {
+                                auto res = parse_option_value(value, element);
+
+                                if (res != option_parse_result::success)
+                                {
+                                    throw_on_input_error<std::ranges::range_value_t<option_type>>(res,
+                                                                                                  prepend_dash(id),
+                                                                                                  element);
+                                }
+                            });
+    }
+
+    /*!\brief Reserves memory for all values recorded for a container option, if the container supports it.
+     * \param[in,out] value       The (empty) container.
+     * \param[in]     occurrences The values recorded for the option.
+     * \param[in]     delimiter   The list delimiter of the option or `'\0'`, see sharg::config::list_delimiter.
+     */
+    template <typename option_type>
+    static void reserve_option_values(option_type & value,
+                                      std::span<option_occurrence const> const occurrences,
+                                      char const delimiter)
+    {
+        if constexpr (requires { value.reserve(occurrences.size()); })
+        {
+            size_t count = occurrences.size();
+
+            if (delimiter != '\0')
+            {
+                for (option_occurrence const & occurrence : occurrences)
+                    count += count_delimiters(occurrence.value, delimiter);
+            }
+
+            value.reserve(count);
+        }
+
+        if constexpr (string_pool_option<option_type>)
+        {
+            size_t character_count{};
+
+            for (option_occurrence const & occurrence : occurrences)
+                character_count += occurrence.value.size();
+
+            value.reserve_characters(character_count);
+        }
+    }
+
+    /*!\brief Handles value retrieval (non container type) options.
+     *
+     * \param[out] value       Stores the value found in arguments, parsed by parse_option_value.
+     * \param[in]  occurrences The values recorded for the option.
+     * \param[in]  id          The option identifier supplied on the command line.
+     *
+     * \throws sharg::option_declared_multiple_times
+     *
+     * \details
+     *
+     * If a value was recorded for the identifier, it is tried to be parsed given the respective option value type.
+     *
+     * Returns true on success and false otherwise. This is needed to catch
+     * the user error of supplying multiple arguments for the same
+     * (non container!) option by specifying the short AND long identifier.
+     */
+    template <typename option_type, typename id_type>
+    static bool
+    get_option_by_id(option_type & value, std::span<option_occurrence const> const occurrences, id_type const & id)
+    {
+        auto by_id = [](option_occurrence const & occurrence)
+        {
+            return occurrence.by_short_id == std::same_as<id_type, char>;
+        };
+
+        auto it = std::find_if(occurrences.begin(), occurrences.end(), by_id);
+
+        if (it == occurrences.end())
+            return false;
+
+        identify_and_retrieve_option_value(value, *it, id);
+
+        if (std::find_if(std::next(it), occurrences.end(), by_id) != occurrences.end()) // should not be found again
+            throw option_declared_multiple_times("Option " + prepend_dash(id)
+                                                 + " is no list/container but declared multiple times.");
+
+        return true;
+    }
+
+    /*!\brief Handles command line option retrieval.
+     *
+     * \param[out] value        The variable in which to store the given command line argument.
+     * \param[in]  config       A configuration object to customise the sharg::parser behaviour. See sharg::config.
+     * \param[in]  occurrences  The values recorded for the option, in command line order.
+     *
+     * \throws sharg::option_declared_multiple_times
+     * \throws sharg::validation_error
+     * \throws sharg::required_option_missing
+     *
+     * \details
+     *
+     * This function
+     * - checks if the option is required but not set,
+     * - retrieves any value found by the short or long identifier,
+     * - throws on (mis)use of both identifiers for non-container type values,
+     * - re-throws the validation exception with appended option information.
+     *
+     * Container options retain the order of values given on the command line, regardless of the identifier used.
+     */
+    template <typename option_type, typename validator_t>
+    static void
+    get_option(option_type & value, config<validator_t> const & config, std::span<option_occurrence const> occurrences)
+    {
+        bool short_id_is_set{false};
+        bool long_id_is_set{false};
+
+        if constexpr (detail::is_container_option<option_type>)
+        {
+            if (!occurrences.empty())
+            {
+                value.clear();
+                reserve_option_values(value, occurrences, config.list_delimiter);
+            }
+
+            for (option_occurrence const & occurrence : occurrences)
+            {
+                if (occurrence.by_short_id)
+                    identify_and_retrieve_container_values(value, occurrence, config.short_id, config.list_delimiter);
+                else
+                    identify_and_retrieve_container_values(value, occurrence, config.long_id, config.list_delimiter);
+            }
+
+            short_id_is_set = !occurrences.empty();
+        }
+        else
+        {
+            short_id_is_set = get_option_by_id(value, occurrences, config.short_id);
+            long_id_is_set = get_option_by_id(value, occurrences, config.long_id);
+
+            // if value is no container we need to check for multiple declarations
+            if (short_id_is_set && long_id_is_set)
+                throw option_declared_multiple_times("Option " + combine_option_names(config.short_id, config.long_id)
+                                                     + " is no list/container but specified multiple times");
+        }
+
+        if (short_id_is_set || long_id_is_set)
+        {
+            try
+            {
+                detail::trace_span span{"validator", trace_label(config)};
+                detail::validator_probe probe{trace_label(config)};
+                validate(value, config);
+            }
+            catch (std::exception & ex)
+            {
+                throw validation_error(std::string("Validation failed for option ")
+                                       + combine_option_names(config.short_id, config.long_id) + ": " + ex.what());
+            }
+        }
+        else // option is not set
+        {
+            // check if option is required
+            if (config.required)
+                throw required_option_missing("Option " + combine_option_names(config.short_id, config.long_id)
+                                              + " is required but not set.");
+        }
+    }
+
+    /*!\brief Reports an unknown option or flag.
+     *
+     * \param[in] unknown_id The first identifier that is not known, including leading dashes; empty if all are known.
+     * \throws sharg::unknown_option if `unknown_id` is not empty.
+     *
+     * \details
+     *
+     * This function is used AFTER all flags and options specified by the developer were parsed. Thus, all identifiers
+     * that were not resolved while tokenizing the arguments are unknown.
+     */
+    static void check_for_unknown_ids(std::string const & unknown_id)
+    {
+        if (unknown_id.empty())
+            return;
+
+        if (unknown_id[1] != '-' && unknown_id.size() > 2) // one dash, but more than one character (-> multiple flags)
+        {
+            throw unknown_option("Unknown flags " + expand_multiple_flags(unknown_id)
+                                 + ". In case this is meant to be a non-option/argument/parameter, "
+                                 + "please specify the start of arguments with '--'. "
+                                 + "See -h/--help for program information.");
+        }
+        else // unknown short or long option
+        {
+            throw unknown_option("Unknown option " + unknown_id
+                                 + ". In case this is meant to be a non-option/argument/parameter, "
+                                 + "please specify the start of non-options with '--'. "
+                                 + "See -h/--help for program information.");
+        }
+    }
+
+    /*!\brief Classifies each command line argument as identifier, option value or positional option.
+     * \tparam handler_t The type of the handler; see below.
+     * \param[in]     arguments   The command line arguments.
+     * \param[in,out] handler     Looks up the identifiers and records the options and flags.
+     * \param[out]    positionals Receives the positional arguments.
+     * \param[out]    unknown_id  Receives the first unknown identifier, including leading dashes.
+     *
+     * \details
+     *
+     * Each argument is visited exactly once. Identifiers are looked up via the handler, which provides
+     * - `find_id(id)` for a `char` and a `std::string_view` identifier, returning an entry whose member `kind` is an
+     *   id_kind,
+     * - `record_option(entry, arg_it, occurrence)`, where `arg_it` is the argument containing the identifier, and
+     * - `record_flag(entry, arg_it)`, which returns `false` if the flag was already given.
+     *
+     * A flag that is given more than once is treated as unknown. All remaining non-empty arguments and all arguments
+     * after \-- are positional options.
+     *
+     * Each character of a short identifier cluster, e.g. `-abc`, is resolved as flag until a character denotes an
+     * option. The remainder of the cluster is then the value of this option, e.g. `-vt4` is equivalent to `-v -t 4`.
+     * If `t` is the last character, the next argument is its value. Characters that are neither a flag nor an option
+     * form an unknown identifier.
+     */
+    template <typename handler_t>
+    static void tokenize(std::span<std::string_view const> const arguments,
+                         handler_t && handler,
+                         positional_state & positionals,
+                         std::string & unknown_id)
+    {
+        auto record_unknown_id = [&unknown_id](std::string_view const id)
+        {
+            if (unknown_id.empty())
+                unknown_id = id;
+        };
+
+        auto const end_of_options_it = std::find(arguments.begin(), arguments.end(), "--");
+
+        for (auto arg_it = arguments.begin(); arg_it != end_of_options_it; ++arg_it)
+        {
+            std::string_view const arg{*arg_it};
+
+            if (arg.size() < 2u || arg[0] != '-') // no identifier, e.g. "value" or "-"
+            {
+                if (!arg.empty())
+                    positionals.arguments.push_back(arg);
+            }
+            else if (arg[1] == '-') // --long or --long=value
+            {
+                std::string_view const id = arg.substr(2u, arg.find('=') - 2u);
+                auto const entry = handler.find_id(id);
+
+                if (entry.kind == id_kind::option)
+                {
+                    auto const id_it = arg_it;
+                    std::string_view const attached_value = arg.substr(id.size() + 2u);
+                    handler.record_option(entry,
+                                          id_it,
+                                          read_option_value(false, attached_value, arg_it, end_of_options_it));
+                }
+                else if (entry.kind != id_kind::flag || id.size() + 2u != arg.size()
+                         || !handler.record_flag(entry, arg_it)) // unknown, flag with value or flag specified twice
+                {
+                    record_unknown_id(arg);
+                }
+            }
+            else // short identifier cluster, e.g. -rGv <=> -r -G -v or -vt4 <=> -v -t 4
+            {
+                std::string unknown_flags{'-'};
+                std::string_view const cluster = arg.substr(1u);
+
+                for (size_t i = 0; i < cluster.size(); ++i)
+                {
+                    auto const entry = handler.find_id(cluster[i]);
+
+                    if (entry.kind == id_kind::option) // -k, -kValue, -k=value, -vk, -vkValue or -vk=value
+                    {
+                        auto const id_it = arg_it;
+                        std::string_view const attached_value = cluster.substr(i + 1u);
+                        handler.record_option(entry,
+                                              id_it,
+                                              read_option_value(true, attached_value, arg_it, end_of_options_it));
+                        break;
+                    }
+                    else if (entry.kind != id_kind::flag || !handler.record_flag(entry, arg_it)) // unknown or twice
+                    {
+                        unknown_flags.push_back(cluster[i]);
+                    }
+                }
+
+                if (unknown_flags.size() > 1u)
+                    record_unknown_id(unknown_flags);
+            }
+        }
+
+        if (end_of_options_it != arguments.end())
+        {
+            for (auto arg_it = std::next(end_of_options_it); arg_it != arguments.end(); ++arg_it)
+                if (!arg_it->empty())
+                    positionals.arguments.push_back(*arg_it);
+        }
+    }
+
+    /*!\brief Reads the value of an option found at `arg_it`.
+     * \param[in]     by_short_id    Whether the option was specified by its short identifier.
+     * \param[in]     attached_value The part of the argument following the identifier, e.g. `=value` or `value`.
+     * \param[in,out] arg_it         The argument containing the identifier; advanced if the next argument is the value.
+     * \param[in]     end_it         The end of the arguments that may contain identifiers.
+     * \returns The value of the option.
+     */
+    static option_occurrence read_option_value(bool const by_short_id,
+                                               std::string_view attached_value,
+                                               std::span<std::string_view const>::iterator & arg_it,
+                                               std::span<std::string_view const>::iterator const end_it)
+    {
+        option_occurrence occurrence{.by_short_id = by_short_id};
+
+        if (!attached_value.empty()) // -keyValue, -key=value or --key=value
+        {
+            if (attached_value[0] == '=')
+                attached_value.remove_prefix(1u);
+
+            occurrence.value = attached_value;
+            occurrence.missing_value = attached_value.empty();
+        }
+        else if (std::next(arg_it) != end_it) // -key value or --key value
+        {
+            ++arg_it;
+            occurrence.value = *arg_it;
+        }
+        else
+        {
+            occurrence.missing_value = true;
+        }
+
+        return occurrence;
+    }
+
+    /*!\brief Handles command line positional option retrieval.
+     *
+     * \param[out]    value       The variable in which to store the given command line argument.
+     * \param[in]     config      The configuration of the positional option. Its validator is applied after parsing.
+     * \param[in,out] positionals The positional arguments collected by tokenize.
+     * \param[in]     count       The number of positional options.
+     *
+     * \throws sharg::parser_error
+     * \throws sharg::too_few_arguments
+     * \throws sharg::validation_error
+     * \throws sharg::design_error
+     *
+     * \details
+     *
+     * This function assumes that tokenize has collected all positional arguments and that check_for_unknown_ids did
+     * not throw. Thus we can simply take the next positional argument(s).
+     *
+     * This function
+     * - checks if the user did not provide enough arguments,
+     * - retrieves the next (no container type) or all (container type) remaining positional arguments
+     */
+    template <typename option_type, typename validator_t>
+    static void get_positional_option(option_type & value,
+                                      config<validator_t> const & config,
+                                      positional_state & positionals,
+                                      size_t const count)
+    {
+        ++positionals.option_number;
+
+        if (positionals.next_argument == positionals.arguments.size())
+            throw too_few_arguments("Not enough positional arguments provided (Need at least " + std::to_string(count)
+                                    + "). See -h/--help for more information.");
+
+        if constexpr (detail::is_container_option<
+                          option_type>) // vector/list will be filled with all remaining arguments
+        {
+            assert(positionals.option_number == count); // checked on set up.
+
+            value.clear();
+
+            for (; positionals.next_argument < positionals.arguments.size(); ++positionals.next_argument)
+            {
+                std::string_view const arg = positionals.arguments[positionals.next_argument];
+                auto res = parse_option_value(value, arg);
+
+                if (res != option_parse_result::success)
+                    throw_on_input_error<option_type>(res,
+                                                      "positional option" + std::to_string(positionals.option_number),
+                                                      arg);
+
+                ++positionals.option_number;
+            }
+        }
+        else
+        {
+            std::string_view const arg = positionals.arguments[positionals.next_argument++];
+            auto res = parse_option_value(value, arg);
+
+            if (res != option_parse_result::success)
+                throw_on_input_error<option_type>(res,
+                                                  "positional option" + std::to_string(positionals.option_number),
+                                                  arg);
+        }
+
+        positional_label_buffer buffer;
+        std::string_view const label = trace_label(buffer, positionals.option_number);
+
+        try
+        {
+            detail::trace_span span{"validator", label};
+            detail::validator_probe probe{label};
+            validate(value, config);
+        }
+        catch (std::exception & ex)
+        {
+            throw validation_error("Validation failed for " + std::string{label} + ": " + ex.what());
+        }
+    }
+
+    /*!\brief Checks that all positional arguments were retrieved.
+     * \param[in] positionals The positional arguments collected by tokenize.
+     * \throws sharg::too_many_arguments
+     *
+     * \details
+     *
+     * This function is used AFTER all flags, options and positional options specified by the developer were parsed.
+     * Thus, all remaining positional arguments are too much.
+     */
+    static void check_for_left_over_args(positional_state const & positionals)
+    {
+        if (positionals.next_argument != positionals.arguments.size())
+            throw too_many_arguments("Too many arguments provided. Please see -h/--help for more information.");
+    }
+
+    /*!\brief Applies the validator of `config` to `value`.
+     * \details
+     * The values of a container option are validated by sharg::detail::parallel_validation if
+     * sharg::config::parallel_validation is set and the validator can be applied to a single value.
+     */
+    template <typename option_type, typename validator_t>
+    static void validate(option_type const & value, config<validator_t> const & config)
+    {
+        if constexpr (detail::is_container_option<option_type> && parallel_validatable<option_type, validator_t>)
+        {
+            if (config.parallel_validation)
+            {
+                parallel_validation{}(value, config.validator);
+                return;
+            }
+        }
+
+        config.validator(value);
+    }
+
+    //!\brief Returns the long identifier of an option or, if it has none, the short identifier for tracing and probes.
+    template <typename validator_t>
+    static std::string_view trace_label(config<validator_t> const & config)
+    {
+        return config.long_id.empty() ? std::string_view{&config.short_id, 1u} : std::string_view{config.long_id};
+    }
+
+    //!\brief The storage of the label of a positional option for tracing and probes.
+    using positional_label_buffer = std::array<char, 40>;
+
+    /*!\brief Returns the label of a positional option for tracing and probes, e.g. "positional option 2".
+     * \param[out] buffer   The storage of the label; must outlive the returned view.
+     * \param[in]  position The position of the positional option, starting at 1.
+     */
+    static std::string_view trace_label(positional_label_buffer & buffer, size_t const position) noexcept
+    {
+        constexpr std::string_view prefix{"positional option "};
+        char * const end = std::ranges::copy(prefix, buffer.data()).out;
+        return {buffer.data(), std::to_chars(end, buffer.data() + buffer.size(), position).ptr};
+    }
+};
+
+} // namespace sharg::detail
@@ -9,17 +9,35 @@
 
 #pragma once
 
+#ifndef _WIN32
+#    include <fcntl.h>
+#    include <spawn.h>
+#    include <unistd.h>
+
+#    include <sys/wait.h>
+
+#    if defined(__APPLE__)
+#        include <crt_externs.h>
+#    endif
+#endif
+
+#include <algorithm>
 #include <array>
 #include <fstream>
 #include <future>
 #include <iostream>
 #include <optional>
-#include <regex>
 #include <sharg/std/charconv>
+#include <string_view>
+#include <thread>
+#include <vector>
 
 #include <sharg/auxiliary.hpp>
+#include <sharg/detail/char_class.hpp>
+#include <sharg/detail/probe.hpp>
 #include <sharg/detail/safe_filesystem_entry.hpp>
 #include <sharg/detail/terminal.hpp>
+#include <sharg/detail/version_check_cache.hpp>
 
 namespace sharg::detail
 {
@@ -28,6 +46,7 @@ namespace sharg::detail
 // function call_server()
 // ------------------------------------------------------------------------------------------------------------------
 
+#if defined(_WIN32)
 /*!\brief Writes a timestamp file and performs the server call to get the newest version information.
  * \ingroup parser
  * \param[in] command  The system command as a string. See sharg::detail::version_checker::command for details.
@@ -43,6 +62,93 @@ inline void call_server(std::string const & command, std::promise<bool> prom)
     else
         prom.set_value(true);
 }
+#else
+/*!\brief Starts the server call to get the newest version information as a child process.
+ * \ingroup parser
+ * \param[in] arguments The path to the program followed by its arguments. See
+ *                      sharg::detail::version_checker::get_program for details.
+ * \param[in] prom      A promise that is set to whether the program succeeded.
+ *
+ * The program is started with `posix_spawn`, i.e. without a shell, and with all standard streams redirected to
+ * `/dev/null`. If supported, all other file descriptors are closed. The program inherits the environment, such that
+ * it uses the proxy (`https_proxy`, `no_proxy`, ...), the CA certificates (`SSL_CERT_FILE`, ...) and the
+ * configuration files (`HOME`) of the user.
+ * A detached thread waits for the child process and sets the promise. Nothing waits for the child process on exit;
+ * the response is read by the next version check.
+ */
+inline void call_server(std::vector<std::string> const & arguments, std::promise<bool> prom)
+{
+    std::vector<char *> argv{};
+    for (std::string const & argument : arguments)
+        argv.push_back(const_cast<char *>(argument.c_str()));
+    argv.push_back(nullptr);
+
+#    if defined(__APPLE__)
+    char ** const envp = *_NSGetEnviron();
+#    else
+    char ** const envp = environ;
+#    endif
+
+    posix_spawn_file_actions_t actions{};
+    posix_spawn_file_actions_init(&actions);
+    posix_spawn_file_actions_addopen(&actions, STDIN_FILENO, "/dev/null", O_RDONLY, 0);
+    posix_spawn_file_actions_addopen(&actions, STDOUT_FILENO, "/dev/null", O_WRONLY, 0);
+    posix_spawn_file_actions_adddup2(&actions, STDOUT_FILENO, STDERR_FILENO);
+#    if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 34))
+    posix_spawn_file_actions_addclosefrom_np(&actions, STDERR_FILENO + 1); // E.g. pipes of the application.
+#    endif
+
+    pid_t pid{};
+    int const error = posix_spawn(&pid, argv[0], &actions, nullptr, argv.data(), envp);
+    posix_spawn_file_actions_destroy(&actions);
+
+    if (error != 0)
+    {
+        prom.set_value(false);
+        return;
+    }
+
+    SHARG_PROBE1(version_check_spawn, pid);
+
+    std::thread{[pid, prom = std::move(prom)]() mutable
+                {
+                    int status{};
+                    prom.set_value(waitpid(pid, &status, 0) == pid && WIFEXITED(status) && WEXITSTATUS(status) == 0);
+                }}
+        .detach();
+}
+
+/*!\brief Returns the path of an executable in one of the absolute directories listed in the `PATH` environment
+ *        variable, or an empty path if there is none.
+ * \ingroup parser
+ * \param[in] name The name of the executable.
+ *
+ * Relative directories, including the empty one, are ignored, such that no program in the working directory is run.
+ * If `PATH` is not set, `/usr/bin:/bin` is searched.
+ */
+inline std::filesystem::path find_program(std::string_view const name)
+{
+    char const * const path_variable = std::getenv("PATH");
+    std::string_view directories{path_variable ? path_variable : "/usr/bin:/bin"};
+
+    while (!directories.empty())
+    {
+        size_t const end = std::min(directories.find(':'), directories.size());
+        std::filesystem::path const directory{directories.substr(0u, end)};
+        directories.remove_prefix(std::min(end + 1u, directories.size()));
+
+        if (!directory.is_absolute())
+            continue;
+
+        std::filesystem::path candidate = directory / name;
+
+        if (access(candidate.c_str(), X_OK) == 0)
+            return candidate;
+    }
+
+    return {};
+}
+#endif
 
 // ------------------------------------------------------------------------------------------------------------------
 // version_checker
@@ -73,7 +179,7 @@ public:
     version_checker(std::string name_, std::string const & version_, std::string const & app_url = std::string{}) :
         name{std::move(name_)}
     {
-        assert(std::regex_match(name, std::regex{"^[a-zA-Z0-9_-]+$"})); // check on construction of the parser
+        assert(app_name_chars.matches(name)); // check on construction of the parser
 
         if (!app_url.empty())
         {
@@ -81,35 +187,23 @@ public:
             message_app_update.append("[APP VERSION INFO] :: Visit " + app_url + " for updates.\n\n");
         }
 
-#if defined(NDEBUG)
-        timestamp_filename = cookie_path / (name + "_usr.timestamp");
-#else
-        timestamp_filename = cookie_path / (name + "_dev.timestamp");
-#endif
-        std::smatch versionMatch;
-
-        // Ensure version string is not corrupt
-        if (!version_.empty() && /*regex allows version prefix instead of exact match */
-            std::regex_search(version_, versionMatch, std::regex("^([[:digit:]]+\\.[[:digit:]]+\\.[[:digit:]]+).*")))
-        {
-            version = versionMatch.str(1); // in case the git revision number is given take only version number
-        }
+        // Ensure version string is not corrupt. A version prefix is allowed instead of an exact match.
+        if (size_t const length = version_prefix_length(version_); length != 0u)
+            version = version_.substr(0u, length); // in case the git revision number is given take only version number
     }
     //!\}
 
-    /*!\brief Initialises the version_checker with the application name and version.
-     * \param[in] prom The promise to track the state of the detached thread which calls sharg::detail::call_server.
+    /*!\brief Prints update information and calls the server for all applications once a day.
+     * \param[in] prom The promise to track the state of the server call of this application. It is set to `false` if
+     *                 no server call is made.
      *
      * The operator performs the following steps:
      *
-     * 1. If a timestamp file already exists, the following behaviour can be expected depending on the file contents:
-     *    * content "NEVER": No server call is performed and no update information is printed.
-     *    * content "ALWAYS": A server call is performed and update information is printed if a version file exists.
-     *    * content is a timestamp: The "time-of-last-version-check" is read from file. The function only
-     *                              continues if the last version check is more than a day old.
+     * 1. The responses of previous server calls, i.e. the version files, of all applications in the
+     *    sharg::detail::version_check_cache are stored in the cache and removed.
      *
-     * 2. If a version file exists, the app version and Sharg version are compared to the current ones and the
-     *    the following message may be printed:
+     * 2. If the cache knows the newest versions of this application, the app version and Sharg version are compared
+     *    to the current ones and the following message may be printed:
      *    **Debug mode** (directed at the developer of the application)
      *    * If the app is unregistered (no version information is available at the server) the developer will be
      *      notified that he has the possibility of registering his application with us
@@ -122,59 +216,45 @@ public:
      *    **Release mode** (directed at the user of the application):
      *    * If the current app version is lower than the one returned by the server call, the user is notified that
      *      a newer version exists.
+     *
+     * 3. The server is called for this application. If no application called the server for all applications
+     *    within the last day, the server is additionally called for other applications in the cache whose user
+     *    decided to always check. Hence, these applications know their newest versions without calling the server.
+     *    Only applications that checked for themselves within sharg::detail::version_checker::max_unseen_age, but
+     *    not within the last day, are considered. Of these, at most
+     *    sharg::detail::version_checker::max_other_server_calls that ran most recently are checked.
      */
     void operator()(std::promise<bool> prom)
     {
-        std::array<int, 3> empty_version{0, 0, 0};
-        std::array<int, 3> srv_app_version{};
-        std::array<int, 3> srv_sharg_version{};
-
-        std::ifstream version_file{cookie_path / (name + ".version")};
-
-        if (version_file.is_open())
-        {
-            std::string line{};
-            std::getline(version_file, line); // get first line which should only contain the version number of the app
-
-            if (line != unregistered_app)
-                srv_app_version = get_numbers_from_version_string(line);
-#if !defined(NDEBUG)
-            else
-                std::cerr << message_unregistered_app;
-#endif // !defined(NDEBUG)
-
-            std::getline(version_file, line); // get second line which should only contain the version number of sharg
-            srv_sharg_version = get_numbers_from_version_string(line);
+        std::filesystem::path const cache_file = cache_filename();
+        int64_t const now = current_time();
+        version_check_cache cache{};
+        bool check_all{false};
 
-            version_file.close();
-        }
+        // Store the responses of the last server calls and claim today's server call for all applications.
+        bool const locked = version_check_cache::update(cache_file,
+                                                        [&](version_check_cache & locked_cache)
+                                                        {
+                                                            locked_cache.get(name).version = version;
+                                                            store_responses(locked_cache);
 
-#if !defined(NDEBUG) // only check Sharg version in debug
-        if (srv_sharg_version != empty_version)
-        {
-            std::array<int, 3> sharg_version = {SHARG_VERSION_MAJOR, SHARG_VERSION_MINOR, SHARG_VERSION_PATCH};
+                                                            check_all = now - locked_cache.last_download >= one_day;
+                                                            if (check_all)
+                                                                locked_cache.last_download = now;
 
-            if (sharg_version < srv_sharg_version)
-                std::cerr << message_sharg_update;
-        }
-#endif
+                                                            cache = locked_cache;
+                                                            return true;
+                                                        });
 
-        if (srv_app_version != empty_version) // app version
-        {
-#if defined(NDEBUG) // only check app version in release
-            if (get_numbers_from_version_string(version) < srv_app_version)
-                std::cerr << message_app_update;
-#endif // defined(NDEBUG)
+        if (!locked)
+            cache = version_check_cache::read(cache_file);
 
-#if !defined(NDEBUG) // only notify developer that app version should be updated on server
-            if (get_numbers_from_version_string(version) > srv_app_version)
-                std::cerr << message_registered_app_update;
-#endif // !defined(NDEBUG)
-        }
+        if (version_check_cache::entry const * const entry = cache.find(name))
+            print_messages(*entry);
 
         std::cerr << std::flush;
 
-        std::string program = get_program();
+        auto const program = get_program();
 
         if (program.empty())
         {
@@ -182,41 +262,26 @@ public:
             return;
         }
 
-        // 'cookie_path' is no user input and `name` is escaped on construction of the parser.
-        std::filesystem::path out_file = cookie_path / (name + ".version");
+        start_server_call(program, name, version, std::move(prom));
 
-        // build up command for server call
-        std::string command = program + // no user defined input
-                              " " + out_file.string() + " "
-                            + std::string{"https://seqan-update.cs.uni-tuebingen.de/check/SeqAn-Sharg_"} +
-#ifdef __linux
-                              "Linux" +
-#elif __APPLE__
-                              "MacOS" +
-#elif defined(_WIN32)
-                              "Windows" +
-#elif __FreeBSD__
-                              "FreeBSD" +
-#elif __OpenBSD__
-                              "OpenBSD" +
-#else
-                              "unknown" +
-#endif
-#if __x86_64__ || __ppc64__
-                              "_64_" +
-#else
-                              "_32_" +
-#endif
-                              name +          // !user input! escaped on construction of the parser
-                              "_" + version + // !user input! escaped on construction of the version_checker
-#if defined(_WIN32)
-                              "; exit  [int] -not $?}\" > nul 2>&1";
-#else
-                              " > /dev/null 2>&1";
-#endif
+        if (!check_all)
+            return;
 
-        // launch a separate thread to not defer runtime.
-        std::thread(call_server, command, std::move(prom)).detach();
+        // An application that has not run for a while may have been removed or may no longer allow the check.
+        std::vector<version_check_cache::entry const *> others{};
+        for (version_check_cache::entry const & entry : cache.entries)
+            if (entry.name != name && entry.decision == "ALWAYS" && is_version_number(entry.version)
+                && now - entry.last_check >= one_day && now - entry.last_check < max_unseen_age)
+                others.push_back(&entry);
+
+        size_t const count = std::min(others.size(), max_other_server_calls);
+        std::ranges::partial_sort(others,
+                                  others.begin() + count,
+                                  std::ranges::greater{},
+                                  &version_check_cache::entry::last_check);
+
+        for (size_t i = 0; i < count; ++i)
+            start_server_call(program, others[i]->name, others[i]->version, std::promise<bool>{});
     }
 
     //!\brief Returns a writable path to store timestamp and version files or an empty path if none exists.
@@ -278,14 +343,18 @@ public:
      * If the user explicitly uses the --version-check option (user_approval is set) it rules out all following
      * decisions. No cookie is written.
      *
-     * If none of the above apply, version check was not explicitly handled so cookie content is checked:
+     * If none of the above apply, version check was not explicitly handled so the entry of the application in the
+     * sharg::detail::version_check_cache is checked. If the last check is less than a day ago, no check is performed.
+     * Otherwise, depending on the decision of the user:
      * * NEVER: Do not perform the version check and do not change the cookie.
-     * * ALWAYS: Do perform the version check once a day and do not change the cookie.
+     * * ALWAYS: Do perform the version check once a day and do not change the decision.
      * * ASK: Ask the user or default the decision once a day.
      *
-     * If the cookie content is "ASK" and the timestamp is older than a day we ask the user,
-     * if possible, what he wants to do, set the according cookie for the next time
-     * and continue. If we cannot ask the user, the default kicks in (do the check).
+     * The time of the check is stored in the cache while holding its lock, such that concurrent launches of the
+     * application perform at most one check per day. If the lock is busy, no check is performed.
+     * If the decision is "ASK", we ask the user, if possible, what he wants to do, store the according decision for
+     * the next time and continue. If we cannot ask the user, the default kicks in (do not check).
+     * Without an entry in the cache, the decision is taken from the timestamp file of previous Sharg versions.
      */
     bool decide_if_check_is_performed(update_notifications developer_approval, std::optional<bool> user_approval)
     {
@@ -299,40 +368,55 @@ public:
             return user_approval.value();
 
         // version check was not explicitly handled so let's check the cookie
-        if (std::filesystem::exists(cookie_path))
-        {
-            std::ifstream timestamp_file{timestamp_filename};
-            std::string cookie_line{};
+        if (cookie_path().empty()) // no writable directory
+            return false;
 
-            if (timestamp_file.is_open())
-            {
-                std::getline(timestamp_file, cookie_line); // first line contains the timestamp
+        std::filesystem::path const cache_file = cache_filename();
+        int64_t const now = current_time();
+        std::string decision{};
 
-                if (get_time_diff_to_current(cookie_line) < 86400 /*one day in seconds*/)
-                {
-                    return false;
-                }
+        if (version_check_cache::entry const * const entry = version_check_cache::read(cache_file).find(name))
+        {
+            if (now - entry->last_check < one_day)
+                return false;
 
-                std::getline(timestamp_file, cookie_line); // second line contains the last user decision
+            decision = entry->decision;
+        }
+        else
+        {
+            decision = legacy_decision();
+        }
 
-                if (cookie_line == "NEVER")
-                {
-                    return false;
-                }
-                else if (cookie_line == "ALWAYS")
-                {
-                    return true;
-                }
-                // else we do not return but continue to ask the user
+        if (decision == "NEVER")
+            return false;
 
-                timestamp_file.close();
-            }
-        }
+        // Claim today's check. Another launch of this application may have claimed it since the cache was read.
+        bool claimed{false};
+        version_check_cache::update(cache_file,
+                                    [&](version_check_cache & cache)
+                                    {
+                                        version_check_cache::entry & entry = cache.get(name);
+                                        claimed = now - entry.last_check >= one_day;
+
+                                        if (claimed)
+                                        {
+                                            entry.version = version;
+                                            entry.last_check = now;
+                                            // Ask again next time, if this is not overwritten.
+                                            if (entry.decision.empty())
+                                                entry.decision = decision.empty() ? "ASK" : decision;
+                                        }
+
+                                        return claimed;
+                                    });
+
+        if (!claimed)
+            return false;
+        else if (decision == "ALWAYS")
+            return true;
 
         // Up until now, the user did not specify the --version-check option, the environment variable was not set,
         // nor did the the cookie tell us what to do. We will now ask the user if possible or do the check by default.
-        write_cookie("ASK"); // Ask again next time when we read the cookie, if this is not overwritten.
-
         if (detail::stdin_is_terminal() && detail::stderr_is_terminal()) // LCOV_EXCL_START
         {
             std::cerr << R"(
@@ -368,12 +452,12 @@ public:
             }
             case 'a':
             {
-                write_cookie(std::string{"ALWAYS"}); // overwrite cookie
+                store_decision("ALWAYS"); // overwrite cookie
                 return true;
             }
             case 'n':
             {
-                write_cookie(std::string{"NEVER"}); // overwrite cookie
+                store_decision("NEVER"); // overwrite cookie
                 return false;
             }
             default:
@@ -427,57 +511,234 @@ public:
     std::string name;
     //!\brief The version of the application.
     std::string version{"0.0.0"};
-    //!\brief The regex to verify a valid version string.
-    std::regex version_regex{"^[[:digit:]]+\\.[[:digit:]]+\\.[[:digit:]]+$"};
-    //!\brief The path to store timestamp and version files (either ~/.config/seqan or the tmp directory).
-    std::filesystem::path cookie_path = get_path();
-    //!\brief The timestamp filename.
-    std::filesystem::path timestamp_filename;
+    //!\brief The URL that the application and version are appended to for the server call.
+    std::string server_url{"https://seqan-update.cs.uni-tuebingen.de/check/"};
+
+    /*!\brief Returns the path to store timestamp and version files (either ~/.config/seqan or the tmp directory).
+     * \details
+     * The path is determined by sharg::detail::version_checker::get_path on first use, because this accesses the file
+     * system. Hence, no file system calls are made unless a version check may be performed.
+     */
+    std::filesystem::path const & cookie_path()
+    {
+        if (!cached_cookie_path)
+            cached_cookie_path = get_path();
+
+        return *cached_cookie_path;
+    }
+
+    //!\brief Returns the file of the sharg::detail::version_check_cache that is shared by all applications.
+    std::filesystem::path cache_filename()
+    {
+#if defined(NDEBUG)
+        return cookie_path() / "sharg_version_check_usr.cache";
+#else
+        return cookie_path() / "sharg_version_check_dev.cache";
+#endif
+    }
+
+    //!\brief Returns the timestamp filename of Sharg versions before the sharg::detail::version_check_cache.
+    std::filesystem::path timestamp_filename()
+    {
+#if defined(NDEBUG)
+        return cookie_path() / (name + "_usr.timestamp");
+#else
+        return cookie_path() / (name + "_dev.timestamp");
+#endif
+    }
 
 private:
+    //!\brief The path returned by cookie_path(); unset until first use.
+    std::optional<std::filesystem::path> cached_cookie_path{};
+
+#if defined(_WIN32)
     //!\brief Returns the command line call as a std::string of an available program depending on the environment.
     static std::string get_program()
     {
-#if defined(_WIN32)
         return "powershell.exe -NoLogo -NonInteractive -Command \"& {Invoke-WebRequest -erroraction 'silentlycontinue' "
                "-OutFile";
+    }
 #else // Unix based platforms.
-        if (!system("/usr/bin/env -i wget --version > /dev/null 2>&1"))
-            return "/usr/bin/env -i wget --timeout=10 --tries=1 -q -O";
-        else if (!system("/usr/bin/env -i curl --version > /dev/null 2>&1"))
-            return "/usr/bin/env -i curl --connect-timeout 10 -o";
+    /*!\brief Returns the path to an available download program followed by its arguments, except for the output file
+     *        and the URL. Empty if no program is available.
+     * \details
+     * The program is looked up in `PATH` instead of probing it by running it, see sharg::detail::find_program.
+     */
+    static std::vector<std::string> get_program()
+    {
+        if (std::filesystem::path program = find_program("wget"); !program.empty())
+            return {program.string(), "--timeout=10", "--tries=1", "-q", "-O"};
+        else if (program = find_program("curl"); !program.empty())
+            return {program.string(), "--connect-timeout", "10", "-o"};
 // In case neither wget nor curl is available try ftp/fetch if system is OpenBSD/FreeBSD.
-// Note, both systems have ftp/fetch command installed by default so we do not guard against it.
 #    if defined(__OpenBSD__)
-        return "/usr/bin/env -i ftp -w10 -Vo";
+        else if (program = find_program("ftp"); !program.empty())
+            return {program.string(), "-w10", "-Vo"};
 #    elif defined(__FreeBSD__)
-        return "/usr/bin/env -i fetch --timeout=10 -o";
-#    else
-        return "";
+        else if (program = find_program("fetch"); !program.empty())
+            return {program.string(), "--timeout=10", "-o"};
 #    endif // __OpenBSD__
-#endif     // defined(_WIN32)
+
+        return {};
     }
+#endif // defined(_WIN32)
 
-    //!\brief Reads the timestamp file if possible and returns the time difference to the current time.
-    double get_time_diff_to_current(std::string const & str_time) const
+    //!\brief One day in seconds.
+    static constexpr int64_t one_day{86400};
+
+    //!\brief Other applications are only checked if they checked for themselves within this many seconds.
+    static constexpr int64_t max_unseen_age{30 * one_day};
+
+    //!\brief The maximum number of server calls for other applications per version check.
+    static constexpr size_t max_other_server_calls{4u};
+
+    //!\brief Returns the current time in seconds since epoch.
+    static int64_t current_time()
     {
         namespace co = std::chrono;
-        double curr = co::duration_cast<co::seconds>(co::system_clock::now().time_since_epoch()).count();
+        return co::duration_cast<co::seconds>(co::system_clock::now().time_since_epoch()).count();
+    }
+
+    //!\brief Returns the decision "ALWAYS" or "NEVER" stored in the timestamp file, or an empty string.
+    std::string legacy_decision()
+    {
+        std::ifstream timestamp_file{timestamp_filename()};
+        std::string cookie_line{};
+
+        std::getline(timestamp_file, cookie_line); // first line contains the timestamp
+        std::getline(timestamp_file, cookie_line); // second line contains the last user decision
+
+        return (cookie_line == "ALWAYS" || cookie_line == "NEVER") ? cookie_line : std::string{};
+    }
+
+    /*!\brief Stores the responses of previous server calls in the cache and removes the version files.
+     * \details
+     * A version file whose first line is empty is kept, because the server call might still be writing it.
+     */
+    void store_responses(version_check_cache & cache)
+    {
+        for (version_check_cache::entry & entry : cache.entries)
+        {
+            std::filesystem::path const version_file = cookie_path() / (entry.name + ".version");
+            std::ifstream version_stream{version_file};
+            std::string app_line{};
+            std::string sharg_line{};
+
+            // first line contains the version number of the app, second line the one of sharg
+            if (!std::getline(version_stream, app_line) || !version_check_cache::is_field(app_line))
+                continue;
+
+            std::getline(version_stream, sharg_line);
+            version_stream.close();
+
+            entry.latest_app_version = app_line;
+            entry.latest_sharg_version = version_check_cache::is_field(sharg_line) ? sharg_line : std::string{};
+
+            std::error_code error{};
+            std::filesystem::remove(version_file, error);
+        }
+    }
+
+    //!\brief Prints the update information of the newest versions known for this application.
+    void print_messages(version_check_cache::entry const & entry) const
+    {
+        std::array<int, 3> empty_version{0, 0, 0};
+        std::array<int, 3> srv_app_version{};
+
+        if (entry.latest_app_version != unregistered_app)
+            srv_app_version = get_numbers_from_version_string(entry.latest_app_version);
+#if !defined(NDEBUG)
+        else
+            std::cerr << message_unregistered_app;
+#endif // !defined(NDEBUG)
 
-        double d_time{};
-        std::from_chars(str_time.data(), str_time.data() + str_time.size(), d_time);
+#if !defined(NDEBUG) // only check Sharg version in debug
+        if (std::array<int, 3> srv_sharg_version = get_numbers_from_version_string(entry.latest_sharg_version);
+            srv_sharg_version != empty_version)
+        {
+            std::array<int, 3> sharg_version = {SHARG_VERSION_MAJOR, SHARG_VERSION_MINOR, SHARG_VERSION_PATCH};
+
+            if (sharg_version < srv_sharg_version)
+                std::cerr << message_sharg_update;
+        }
+#endif
+
+        if (srv_app_version != empty_version) // app version
+        {
+#if defined(NDEBUG) // only check app version in release
+            if (get_numbers_from_version_string(version) < srv_app_version)
+                std::cerr << message_app_update;
+#endif // defined(NDEBUG)
 
-        return curr - d_time;
+#if !defined(NDEBUG) // only notify developer that app version should be updated on server
+            if (get_numbers_from_version_string(version) > srv_app_version)
+                std::cerr << message_registered_app_update;
+#endif // !defined(NDEBUG)
+        }
+    }
+
+    /*!\brief Starts the server call for an application, which stores the response in the version file.
+     * \param[in] program     The program returned by get_program().
+     * \param[in] app_name    The name of the application.
+     * \param[in] app_version The version of the application.
+     * \param[in] prom        The promise to track the server call.
+     */
+    template <typename program_t>
+    void start_server_call(program_t const & program,
+                           std::string const & app_name,
+                           std::string const & app_version,
+                           std::promise<bool> prom)
+    {
+        // 'cookie_path' is no user input and the name is checked on construction of the parser or the cache.
+        std::filesystem::path out_file = cookie_path() / (app_name + ".version");
+
+        // build up the url of the server call
+        std::string const url = server_url + "SeqAn-Sharg_" +
+#ifdef __linux
+                                "Linux" +
+#elif __APPLE__
+                                "MacOS" +
+#elif defined(_WIN32)
+                                "Windows" +
+#elif __FreeBSD__
+                                "FreeBSD" +
+#elif __OpenBSD__
+                                "OpenBSD" +
+#else
+                                "unknown" +
+#endif
+#if __x86_64__ || __ppc64__
+                                "_64_" +
+#else
+                                "_32_" +
+#endif
+                                app_name +         // !user input! escaped on construction of the parser or cache
+                                "_" + app_version; // !user input! escaped on construction of the version_checker
+
+#if defined(_WIN32)
+        // build up command for server call
+        std::string command = program + " " + out_file.string() + " " + url + "; exit  [int] -not $?}\" > nul 2>&1";
+
+        // launch a separate thread to not defer runtime.
+        std::thread(call_server, command, std::move(prom)).detach();
+#else
+        std::vector<std::string> arguments = program;
+        arguments.push_back(out_file.string());
+        arguments.push_back(url);
+
+        // launch a separate process to not defer runtime.
+        call_server(arguments, std::move(prom));
+#endif
     }
 
     /*!\brief Parses a version string into an array of length 3.
-     * \param[in] str The version string that must match sharg::detail::version_regex.
+     * \param[in] str The version string; see sharg::detail::is_version_number.
      */
     std::array<int, 3> get_numbers_from_version_string(std::string const & str) const
     {
         std::array<int, 3> result{};
 
-        if (!std::regex_match(str, version_regex))
+        if (!is_version_number(str))
             return result;
 
         auto res = std::from_chars(str.data(), str.data() + str.size(), result[0]); // stops and sets res.ptr at '.'
@@ -487,24 +748,15 @@ private:
         return result;
     }
 
-    /*!\brief Writes a cookie file with a specified message.
-     * \tparam    msg_type The type of message.
-     * \param[in] msg      The message to write into the file (no newline is appended).
-     */
-    template <typename msg_type>
-    void write_cookie(msg_type && msg)
+    //!\brief Stores the decision of the user in the cache.
+    void store_decision(std::string const & decision)
     {
-        // The current time
-        namespace co = std::chrono;
-        auto curr = co::duration_cast<co::seconds>(co::system_clock::now().time_since_epoch()).count();
-
-        std::ofstream timestamp_file{timestamp_filename};
-
-        if (timestamp_file.is_open())
-        {
-            timestamp_file << curr << '\n' << msg;
-            timestamp_file.close();
-        }
+        version_check_cache::update(cache_filename(),
+                                    [&](version_check_cache & cache)
+                                    {
+                                        cache.get(name).decision = decision;
+                                        return true;
+                                    });
     }
 };
 
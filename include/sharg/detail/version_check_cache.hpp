@@ -0,0 +1,309 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \author Enrico Seiler <enrico.seiler AT fu-berlin.de>
+ * \brief Provides sharg::detail::version_check_cache.
+ */
+
+#pragma once
+
+#ifndef _WIN32
+#    include <fcntl.h>
+#    include <unistd.h>
+
+#    include <sys/file.h>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <sharg/std/charconv>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <sharg/detail/char_class.hpp>
+
+namespace sharg::detail
+{
+
+/*!\brief The state of the version check of all applications of a user, stored in a single file.
+ * \ingroup parser
+ *
+ * \details
+ *
+ * The file is shared by all Sharg applications. It is read without locking, because it is only ever replaced as a
+ * whole by renaming a temporary file. Modifications are serialised by sharg::detail::version_check_cache::update,
+ * which holds an exclusive `flock` on a separate lock file while it reads, modifies and replaces the cache file.
+ * If another process holds the lock for too long, the update is skipped instead of blocking the application.
+ *
+ * The file consists of a header line, the time of the last server call and one tab-separated line per application:
+ *
+ * ```
+ * sharg_version_check_cache 1
+ * last_download <seconds since epoch>
+ * <name>\t<version>\t<decision>\t<last check>\t<latest app version>\t<latest Sharg version>
+ * ```
+ *
+ * Empty fields are stored as `-`. Lines that cannot be parsed are dropped.
+ */
+class version_check_cache
+{
+public:
+    //!\brief The version check state of one application.
+    struct entry
+    {
+        std::string name{};                 //!< The name of the application.
+        std::string version{};              //!< The installed version of the application.
+        std::string decision{};             //!< The decision of the user: "ASK", "ALWAYS", "NEVER" or empty.
+        int64_t last_check{};               //!< The time of the last version check, in seconds since epoch.
+        std::string latest_app_version{};   //!< The newest version of the application according to the server.
+        std::string latest_sharg_version{}; //!< The newest Sharg version according to the server.
+    };
+
+    //!\brief The time of the last server call for all applications, in seconds since epoch.
+    int64_t last_download{};
+    //!\brief The state of each application.
+    std::vector<entry> entries{};
+
+    //!\brief Returns the entry of the application `name`, or `nullptr` if there is none.
+    entry const * find(std::string_view const name) const
+    {
+        auto it = std::ranges::find(entries, name, &entry::name);
+        return (it == entries.end()) ? nullptr : &*it;
+    }
+
+    //!\brief Returns the entry of the application `name`. Adds an empty entry if there is none.
+    entry & get(std::string_view const name)
+    {
+        auto it = std::ranges::find(entries, name, &entry::name);
+
+        if (it != entries.end())
+            return *it;
+
+        return entries.emplace_back(entry{.name = std::string{name}});
+    }
+
+    /*!\brief Whether `value` can be stored as a field, i.e. it is not empty and does not contain whitespace or
+     *        control characters.
+     */
+    static bool is_field(std::string_view const value)
+    {
+        return !value.empty()
+            && std::ranges::all_of(value,
+                                   [](char const c)
+                                   {
+                                       return static_cast<unsigned char>(c) > ' ' && c != '\x7f';
+                                   });
+    }
+
+    /*!\brief Reads the cache file.
+     * \param[in] file The cache file.
+     * \returns The cache; empty if the file does not exist or has an unknown format.
+     */
+    static version_check_cache read(std::filesystem::path const & file)
+    {
+        version_check_cache cache{};
+        std::ifstream stream{file};
+        std::string line{};
+
+        if (!std::getline(stream, line) || line != header)
+            return cache;
+
+        if (!std::getline(stream, line) || !line.starts_with("last_download ")
+            || !parse_time(std::string_view{line}.substr(14u), cache.last_download))
+            return cache;
+
+        while (std::getline(stream, line))
+        {
+            std::array<std::string_view, 6> fields{};
+            std::string_view rest{line};
+            size_t count{};
+
+            for (; count < fields.size() && !rest.empty(); ++count)
+            {
+                size_t const end = std::min(rest.find('\t'), rest.size());
+                fields[count] = rest.substr(0u, end);
+                rest.remove_prefix(std::min(end + 1u, rest.size()));
+            }
+
+            entry current{};
+
+            if (count != fields.size() || !rest.empty() || !app_name_chars.matches(fields[0])
+                || !parse_time(fields[3], current.last_check))
+                continue;
+
+            current.name = fields[0];
+            current.version = read_field(fields[1]);
+            current.decision = read_field(fields[2]);
+            current.latest_app_version = read_field(fields[4]);
+            current.latest_sharg_version = read_field(fields[5]);
+            cache.entries.push_back(std::move(current));
+        }
+
+        return cache;
+    }
+
+    /*!\brief Modifies the cache file atomically.
+     * \param[in] file   The cache file.
+     * \param[in] update A callable that modifies the given sharg::detail::version_check_cache and returns whether
+     *                   it should be written.
+     * \returns Whether the cache file was locked and `update` was called.
+     *
+     * \details
+     *
+     * Locks the file, reads it, calls `update` and, if it returns `true`, writes the cache to a temporary file that
+     * is renamed to `file`. If the file is still locked by another process after
+     * sharg::detail::version_check_cache::lock_timeout, nothing is done and `false` is returned.
+     * Errors are not reported, the version check must never affect the application.
+     * On Windows, the file is not locked.
+     */
+    template <typename update_t>
+    static bool update(std::filesystem::path const & file, update_t && update)
+    {
+        lock const guard{lock_filename(file)};
+
+        if (!guard.is_locked())
+            return false;
+
+        version_check_cache cache = read(file);
+
+        if (update(cache))
+            cache.write(file);
+
+        return true;
+    }
+
+    //!\brief Returns the name of the lock file of `file`.
+    static std::filesystem::path lock_filename(std::filesystem::path file)
+    {
+        file += ".lock";
+        return file;
+    }
+
+private:
+    //!\brief The first line of the file.
+    static constexpr std::string_view header{"sharg_version_check_cache 1"};
+
+    //!\brief How long sharg::detail::version_check_cache::update tries to lock the file.
+    static constexpr std::chrono::milliseconds lock_timeout{100};
+
+    //!\brief An exclusive `flock` on a file. The lock file is not the cache file, because the latter is replaced.
+    class lock
+    {
+    public:
+        /*!\brief Opens or creates `file` and tries to lock it.
+         * \details
+         * The lock is not waited for, because it may be held by a process that hangs. Instead, locking is retried
+         * until sharg::detail::version_check_cache::lock_timeout has passed.
+         */
+        explicit lock([[maybe_unused]] std::filesystem::path const & file)
+        {
+#ifndef _WIN32
+            fd = ::open(file.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+
+            if (fd < 0)
+                return;
+
+            auto const deadline = std::chrono::steady_clock::now() + lock_timeout;
+
+            while (::flock(fd, LOCK_EX | LOCK_NB) != 0)
+            {
+                if ((errno != EWOULDBLOCK && errno != EINTR) || std::chrono::steady_clock::now() >= deadline)
+                {
+                    ::close(fd);
+                    fd = -1;
+                    return;
+                }
+
+                std::this_thread::sleep_for(std::chrono::milliseconds{1});
+            }
+#endif
+        }
+
+        lock(lock const &) = delete;             //!< Deleted.
+        lock & operator=(lock const &) = delete; //!< Deleted.
+
+        //!\brief Releases the lock by closing the file.
+        ~lock()
+        {
+#ifndef _WIN32
+            if (fd >= 0)
+                ::close(fd);
+#endif
+        }
+
+        //!\brief Whether the lock is held. Always `true` on Windows.
+        bool is_locked() const
+        {
+#ifndef _WIN32
+            return fd >= 0;
+#else
+            return true;
+#endif
+        }
+
+    private:
+        int fd{-1}; //!< The file descriptor of the lock file.
+    };
+
+    //!\brief Parses a time in seconds since epoch.
+    static bool parse_time(std::string_view const value, int64_t & time)
+    {
+        auto [ptr, ec] = std::from_chars(value.data(), value.data() + value.size(), time);
+        return ec == std::errc{} && ptr == value.data() + value.size();
+    }
+
+    //!\brief Returns the value of a field; empty for `-`.
+    static std::string read_field(std::string_view const value)
+    {
+        return (value == "-" || !is_field(value)) ? std::string{} : std::string{value};
+    }
+
+    //!\brief Returns a value as field; `-` if it is empty or invalid.
+    static std::string_view write_field(std::string const & value)
+    {
+        return is_field(value) ? std::string_view{value} : std::string_view{"-"};
+    }
+
+    //!\brief Writes the cache to a temporary file and renames it to `file`. Must be called while holding the lock.
+    void write(std::filesystem::path const & file) const
+    {
+        std::filesystem::path temporary = file;
+        temporary += ".tmp";
+
+        {
+            std::ofstream stream{temporary, std::ios::trunc};
+
+            stream << header << '\n' << "last_download " << last_download << '\n';
+
+            for (entry const & current : entries)
+            {
+                if (!app_name_chars.matches(current.name))
+                    continue;
+
+                stream << current.name << '\t' << write_field(current.version) << '\t' << write_field(current.decision)
+                       << '\t' << current.last_check << '\t' << write_field(current.latest_app_version) << '\t'
+                       << write_field(current.latest_sharg_version) << '\n';
+            }
+
+            if (!stream.flush())
+                return;
+        }
+
+        std::error_code error{};
+        std::filesystem::rename(temporary, file, error);
+
+        if (error)
+            std::filesystem::remove(temporary, error);
+    }
+};
+
+} // namespace sharg::detail
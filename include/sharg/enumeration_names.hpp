@@ -13,6 +13,7 @@
 #include <string_view>
 #include <unordered_map>
 
+#include <sharg/enumeration_table.hpp>
 #include <sharg/platform.hpp>
 
 namespace sharg::custom
@@ -32,6 +33,18 @@ namespace sharg::custom
  *
  * \include test/snippet/custom_parsing_enumeration.cpp
  *
+ * ### Value parsing
+ *
+ * Values of types that are neither arithmetic, nor named enumerations, nor constructible from a std::string_view
+ * are parsed with a std::istringstream and their `operator>>`. To parse them without a stream, specialise this
+ * struct with a static member function `from_chars` that returns `std::errc{}` on success,
+ * `std::errc::result_out_of_range` if the value is out of range, and any other `std::errc`, e.g.
+ * `std::errc::invalid_argument`, if the argument is invalid:
+ *
+ * \include test/snippet/custom_parsing_from_chars.cpp
+ *
+ * If present, `from_chars` is preferred over `operator>>` and all built-in conversions.
+ *
  * Please note that by default the `t const`, `t &` and `t const &` specialisations of this class inherit the
  * specialisation for `t` so you usually only need to provide a specialisation for `t`.
  *
@@ -174,7 +187,8 @@ namespace sharg
 /*!\brief Return a conversion map from std::string_view to option_type.
  * \tparam your_type Type of the value to retrieve the conversion map for.
  * \param value The value is not accessed, only its type is used.
- * \returns A std::unordered_map<std::string_view, your_type> that maps a string identifier to a value of your_type.
+ * \returns A std::unordered_map<std::string_view, your_type> or a sharg::enumeration_table that maps a string
+ *          identifier to a value of your_type.
  * \ingroup misc
  * \details
  *
@@ -187,6 +201,9 @@ namespace sharg
  *   2. A free function `enumeration_names(your_type const a)` in the namespace of your type (or as `friend`) which
  *      returns a `std::unordered_map<std::string_view, your_type>>`.
  *
+ * Instead of a `std::unordered_map`, a sharg::enumeration_table may be used. If the customisation is `constexpr`,
+ * the table is then initialised at compile time and finding a value or a name takes constant time.
+ *
  * ### Example
  *
  * If you are working on a type in your namespace, you should implement a free function like this:
@@ -223,7 +240,7 @@ inline auto const enumeration_names = detail::adl_only::enumeration_names_cpo<op
  * ### Requirements
  *
  * * An instance of sharg::enumeration_names<option_type> must exist and be of the type
- *   `std::unordered_map<std::string, option_type>`.
+ *   `std::unordered_map<std::string, option_type>` or sharg::enumeration_table.
  *
  * \remark For a complete overview, take a look at \ref parser
  *
@@ -251,7 +268,15 @@ template <typename option_type>
     requires sharg::named_enumeration<remove_cvref_t<option_type>>
 inline ostream & operator<<(ostream & s, option_type && op)
 {
-    for (auto & [key, value] : sharg::enumeration_names<option_type>)
+    auto const & names = sharg::enumeration_names<option_type>;
+
+    if constexpr (requires { names.find_value(op); })
+    {
+        auto it = names.find_value(op);
+        return (it != names.end()) ? s << it->first : s << "<UNKNOWN_VALUE>";
+    }
+
+    for (auto & [key, value] : names)
     {
         if (op == value)
             return s << key;
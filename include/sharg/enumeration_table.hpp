@@ -0,0 +1,390 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \author Enrico Seiler <enrico.seiler AT fu-berlin.de>
+ * \brief Provides sharg::enumeration_table and sharg::detail::is_enumeration_table.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include <sharg/exceptions.hpp>
+
+namespace sharg
+{
+
+/*!\brief A constant table of names and values that can be returned by the customisation point
+ *        sharg::enumeration_names.
+ * \ingroup misc
+ * \tparam option_t The type of the values, e.g. an enumeration. Must be totally ordered.
+ * \tparam count    The number of names. Must be greater than zero.
+ *
+ * \details
+ *
+ * In contrast to a `std::unordered_map`, the table can be constructed at compile time. A sharg::enumeration_names
+ * that is a sharg::enumeration_table is hence initialised statically if the customisation is `constexpr`:
+ *
+ * \include test/snippet/enumeration_table.cpp
+ *
+ * The table offers the interface of a constant map that is needed by Sharg, i.e. sharg::enumeration_table::find,
+ * sharg::enumeration_table::begin and sharg::enumeration_table::end, and can therefore replace a
+ * `std::unordered_map` without further changes.
+ *
+ * - Finding the value of a name uses a perfect hash, i.e. hashes the name once and compares a single name.
+ * - Finding the name of a value (sharg::enumeration_table::find_value) takes constant time if the integral values of
+ *   an enumeration are dense, i.e. span a range no larger than the number of names. Otherwise, the values are
+ *   searched by binary search.
+ * - The elements are ordered by their value and, for equal values, in the order they were given. Hence, the first
+ *   name given for a value is its name when printing the value.
+ *
+ * Names must be unique; a value may have multiple names. If a name is given twice, a sharg::design_error is thrown,
+ * which is a compile error if the table is constructed at compile time.
+ *
+ * \experimentalapi{Experimental since version 1.2.3.}
+ */
+template <typename option_t, size_t count>
+    requires std::totally_ordered<option_t> && std::is_trivially_copyable_v<option_t> && (count > 0u)
+class enumeration_table
+{
+public:
+    //!\brief The type of an element, i.e. a name and its value.
+    using value_type = std::pair<std::string_view, option_t>;
+    //!\brief The type of the iterators.
+    using const_iterator = value_type const *;
+    //!\brief The type of the iterators. The table is constant.
+    using iterator = const_iterator;
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    enumeration_table() = delete;                                                //!< Deleted.
+    constexpr enumeration_table(enumeration_table const &) = default;             //!< Defaulted.
+    constexpr enumeration_table(enumeration_table &&) = default;                  //!< Defaulted.
+    constexpr enumeration_table & operator=(enumeration_table const &) = default; //!< Defaulted.
+    constexpr enumeration_table & operator=(enumeration_table &&) = default;      //!< Defaulted.
+    constexpr ~enumeration_table() = default;                                     //!< Defaulted.
+
+    /*!\brief Constructs the table from names and values.
+     * \param[in] names The names and their values, e.g. `{{"red", colour::red}, {"green", colour::green}}`.
+     * \throws sharg::design_error if a name is given more than once.
+     */
+    constexpr enumeration_table(value_type const (&names)[count])
+    {
+        sort_by_value(names);
+        build_name_index();
+        build_value_index();
+    }
+    //!\}
+
+    /*!\brief Returns the element with the name `name`.
+     * \param[in] name The name to search for.
+     * \returns An iterator to the element or sharg::enumeration_table::end if there is no such name.
+     */
+    constexpr const_iterator find(std::string_view const name) const noexcept
+    {
+        uint64_t const name_hash = hash(name);
+        index_t const index = slots[slot(name_hash, bucket_seeds[bucket(name_hash)])];
+
+        return (index != empty && elements[index].first == name) ? begin() + index : end();
+    }
+
+    /*!\brief Returns the first element with the value `value`.
+     * \param[in] value The value to search for.
+     * \returns An iterator to the element or sharg::enumeration_table::end if there is no such value.
+     */
+    constexpr const_iterator find_value(option_t const value) const noexcept
+    {
+        if constexpr (has_integral_value)
+        {
+            if (is_dense)
+            {
+                uint64_t const offset = to_integral(value) - to_integral(elements[0].second);
+                return (offset < count && value_index[offset] != empty) ? begin() + value_index[offset] : end();
+            }
+        }
+
+        const_iterator it = std::ranges::lower_bound(elements, value, {}, &value_type::second);
+        return (it != end() && it->second == value) ? it : end();
+    }
+
+    //!\brief Whether there is an element with the name `name`.
+    constexpr bool contains(std::string_view const name) const noexcept
+    {
+        return find(name) != end();
+    }
+
+    //!\brief Returns an iterator to the first element.
+    constexpr const_iterator begin() const noexcept
+    {
+        return elements.data();
+    }
+
+    //!\brief Returns an iterator behind the last element.
+    constexpr const_iterator end() const noexcept
+    {
+        return elements.data() + count;
+    }
+
+    //!\brief Returns the number of elements.
+    static constexpr size_t size() noexcept
+    {
+        return count;
+    }
+
+private:
+    //!\brief The type of an index into sharg::enumeration_table::elements.
+    using index_t = uint32_t;
+
+    //!\brief Marks an empty slot.
+    static constexpr index_t empty{std::numeric_limits<index_t>::max()};
+
+    //!\brief The number of slots of the perfect hash; at most half of them are used.
+    static constexpr size_t slot_count{std::bit_ceil(2u * count + 1u)};
+
+    //!\brief Whether the values can be converted to an integer, i.e. whether a dense value index may be used.
+    static constexpr bool has_integral_value{std::is_enum_v<option_t> || std::integral<option_t>};
+
+    //!\brief The elements, ordered by value.
+    std::array<value_type, count> elements{};
+    //!\brief The seed of the second hash, per bucket of the first hash.
+    std::array<uint64_t, count> bucket_seeds{};
+    //!\brief The position in sharg::enumeration_table::elements, per slot of the perfect hash.
+    std::array<index_t, slot_count> slots{};
+    //!\brief If the values are dense, the position of the first element per value, offset by the smallest value.
+    std::array<index_t, count> value_index{};
+    //!\brief Whether sharg::enumeration_table::value_index is used.
+    bool is_dense{false};
+
+    //!\brief Reads `size` characters as a little endian integer. At runtime, this is a single load.
+    template <typename word_t>
+    static constexpr uint64_t load(char const * const data) noexcept
+    {
+        word_t word{};
+
+        if consteval
+        {
+            for (size_t i = 0; i < sizeof(word_t); ++i)
+                word |= static_cast<word_t>(static_cast<unsigned char>(data[i])) << (8u * i);
+        }
+        else
+        {
+            std::memcpy(&word, data, sizeof(word_t));
+
+            if constexpr (std::endian::native == std::endian::big)
+                word = std::byteswap(word);
+        }
+
+        return word;
+    }
+
+    //!\brief Hashes `name` eight characters at a time.
+    static constexpr uint64_t hash(std::string_view const name) noexcept
+    {
+        char const * const data = name.data();
+        size_t const size = name.size();
+
+        auto mix = [](uint64_t result, uint64_t const word)
+        {
+            result = (result ^ word) * 0xBF58476D1CE4E5B9ULL;
+            return result ^ (result >> 31);
+        };
+
+        uint64_t result = size * 0x9E3779B97F4A7C15ULL;
+
+        if (size >= 8u)
+        {
+            for (size_t position = 0; position + 8u < size; position += 8u)
+                result = mix(result, load<uint64_t>(data + position));
+
+            // The last eight characters, which may overlap with the previous ones.
+            return mix(result, load<uint64_t>(data + size - 8u));
+        }
+        else if (size >= 4u)
+        {
+            return mix(result, load<uint32_t>(data) | (load<uint32_t>(data + size - 4u) << 32));
+        }
+        else if (size > 0u)
+        {
+            return mix(result,
+                       static_cast<unsigned char>(data[0]) | (static_cast<unsigned char>(data[size / 2u]) << 8)
+                           | (static_cast<unsigned char>(data[size - 1u]) << 16));
+        }
+
+        return result;
+    }
+
+    //!\brief The bucket of a name, given its hash. Maps the upper half of the hash to [0, count) without a division.
+    static constexpr size_t bucket(uint64_t const name_hash) noexcept
+    {
+        return ((name_hash >> 32) * count) >> 32;
+    }
+
+    //!\brief The slot of a name, given its hash and the seed of its bucket. Uses the upper bits of the product.
+    static constexpr size_t slot(uint64_t const name_hash, uint64_t const seed) noexcept
+    {
+        return ((name_hash ^ seed) * 0xD6E8FEB86659FD93ULL) >> (64 - std::countr_zero(slot_count));
+    }
+
+    //!\brief Converts a value to an integer; the difference of two converted values is the distance of the values.
+    static constexpr uint64_t to_integral(option_t const value) noexcept
+        requires has_integral_value
+    {
+        if constexpr (std::is_enum_v<option_t>)
+            return static_cast<uint64_t>(static_cast<std::underlying_type_t<option_t>>(value));
+        else
+            return static_cast<uint64_t>(value);
+    }
+
+    //!\brief Stores the elements ordered by value and, for equal values, by their position in `names`.
+    constexpr void sort_by_value(value_type const (&names)[count])
+    {
+        std::array<index_t, count> order{};
+        for (size_t i = 0; i < count; ++i)
+            order[i] = static_cast<index_t>(i);
+
+        std::ranges::sort(order,
+                          [&names](index_t const lhs, index_t const rhs)
+                          {
+                              if (names[lhs].second != names[rhs].second)
+                                  return names[lhs].second < names[rhs].second;
+
+                              return lhs < rhs;
+                          });
+
+        for (size_t i = 0; i < count; ++i)
+            elements[i] = names[order[i]];
+    }
+
+    /*!\brief Builds the perfect hash by hash and displace.
+     * \throws sharg::design_error if a name is given more than once.
+     * \details
+     * The names are distributed to `count` buckets by their hash. Starting with the largest bucket, a seed is searched
+     * for each bucket such that the slots of all names of the bucket are empty.
+     */
+    constexpr void build_name_index()
+    {
+        slots.fill(empty);
+
+        std::array<index_t, count> bucket_of{};
+        std::array<index_t, count> bucket_size{};
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            bucket_of[i] = static_cast<index_t>(bucket(hash(elements[i].first)));
+            ++bucket_size[bucket_of[i]];
+        }
+
+        std::array<index_t, count> bucket_order{};
+        for (size_t i = 0; i < count; ++i)
+            bucket_order[i] = static_cast<index_t>(i);
+
+        std::ranges::sort(bucket_order,
+                          [&bucket_size](index_t const lhs, index_t const rhs)
+                          {
+                              if (bucket_size[lhs] != bucket_size[rhs])
+                                  return bucket_size[lhs] > bucket_size[rhs];
+
+                              return lhs < rhs;
+                          });
+
+        std::array<index_t, count> members{};
+
+        for (index_t const current_bucket : bucket_order)
+        {
+            size_t member_count{};
+            for (size_t i = 0; i < count; ++i)
+            {
+                if (bucket_of[i] != current_bucket)
+                    continue;
+
+                for (size_t j = 0; j < member_count; ++j)
+                    if (elements[members[j]].first == elements[i].first)
+                        throw design_error{"The enumeration name \"" + std::string{elements[i].first}
+                                           + "\" is given more than once."};
+
+                members[member_count++] = static_cast<index_t>(i);
+            }
+
+            if (member_count == 0u)
+                continue;
+
+            for (uint64_t attempt = 1u;; ++attempt)
+            {
+                uint64_t const seed = attempt * 0x9E3779B97F4A7C15ULL;
+                std::array<size_t, count> candidate{};
+                bool placed{true};
+
+                for (size_t j = 0; j < member_count && placed; ++j)
+                {
+                    candidate[j] = slot(hash(elements[members[j]].first), seed);
+                    placed = slots[candidate[j]] == empty
+                          && std::ranges::find(candidate.begin(), candidate.begin() + j, candidate[j])
+                                 == candidate.begin() + j;
+                }
+
+                if (placed)
+                {
+                    for (size_t j = 0; j < member_count; ++j)
+                        slots[candidate[j]] = members[j];
+
+                    bucket_seeds[current_bucket] = seed;
+                    break;
+                }
+            }
+        }
+    }
+
+    //!\brief Builds sharg::enumeration_table::value_index if the values are integral and dense.
+    constexpr void build_value_index()
+    {
+        if constexpr (has_integral_value)
+        {
+            uint64_t const range = to_integral(elements[count - 1u].second) - to_integral(elements[0].second);
+
+            if (range >= count)
+                return;
+
+            value_index.fill(empty);
+
+            // Elements are ordered by value; the first element of a value is the first one given.
+            for (size_t i = count; i-- > 0u;)
+                value_index[to_integral(elements[i].second) - to_integral(elements[0].second)] =
+                    static_cast<index_t>(i);
+
+            is_dense = true;
+        }
+    }
+};
+
+} // namespace sharg
+
+namespace sharg::detail
+{
+
+/*!\brief Whether `type` is a sharg::enumeration_table.
+ * \ingroup misc
+ * \details
+ * \noapi
+ */
+template <typename type>
+inline constexpr bool is_enumeration_table = false;
+
+//!\cond
+template <typename option_t, size_t count>
+inline constexpr bool is_enumeration_table<enumeration_table<option_t, count>> = true;
+//!\endcond
+
+} // namespace sharg::detail
@@ -9,16 +9,25 @@
 
 #pragma once
 
+#include <span>
 #include <unordered_set>
 #include <variant>
 
 #include <sharg/config.hpp>
+#include <sharg/detail/char_class.hpp>
+#include <sharg/detail/config_verifier.hpp>
 #include <sharg/detail/format_help.hpp>
 #include <sharg/detail/format_html.hpp>
 #include <sharg/detail/format_man.hpp>
 #include <sharg/detail/format_parse.hpp>
 #include <sharg/detail/format_tdl.hpp>
-#include <sharg/detail/version_check.hpp>
+#include <sharg/detail/option_table.hpp>
+#include <sharg/detail/probe.hpp>
+#include <sharg/detail/response_file.hpp>
+#include <sharg/detail/trace.hpp>
+#if !SHARG_DISABLE_VERSION_CHECK
+#    include <sharg/detail/version_check.hpp>
+#endif
 
 namespace sharg
 {
@@ -98,9 +107,18 @@ namespace sharg
  *
  * 1. Options without arguments can use one hyphen, for example `-a -b` is equivalent to `-ab`.
  * 2. Whitespaces between a short option and its argument are optional. For example, `-c foo` is equivalent to `-cfoo`.
+ *    A short option may also end a cluster of flags, for example `-ab -c foo` is equivalent to `-abcfoo`.
  * 3. `--` terminates the options and signals that only positional options follow. This enables the user to
  * use a positional option beginning with `-` without it being misinterpreted as an option identifier.
  *
+ * ### Response files
+ *
+ * Command lines may exceed the limits of the operating system, e.g. when passing hundreds of thousands of files.
+ * After calling sharg::parser::set_response_file_mode, each argument `@file` is replaced by the arguments contained in
+ * `file`, for example `./app @inputs.txt` with one path per line in `inputs.txt`. The contents are not copied:
+ * Regular files are memory-mapped and the arguments refer to the mapped memory.
+ * Response files may refer to further response files. No arguments after `--` are expanded.
+ *
  * \attention Currently, the sharg::parser is in disagreement with one of the
  * [POSIX conventions](https://www.gnu.org/software/libc/manual/html_node/Argument-Syntax.html). It does not
  * interpret a single hyphen character as an ordinary non-option argument that may be used for in-/output from
@@ -152,6 +170,10 @@ namespace sharg
  * Note that in case there is no `--version-check` option (display available options with `-h/--help)`,
  * then the developer already disabled the version check functionality.
  *
+ * Builds that define #SHARG_DISABLE_VERSION_CHECK to `1`, e.g. via the CMake option `SHARG_DISABLE_VERSION_CHECK`,
+ * contain no version check at all. The parser then behaves as if sharg::update_notifications::off was passed, except
+ * that `--version-check` is an unknown option.
+ *
  * \stableapi{Since version 1.0.}
  */
 class parser
@@ -180,17 +202,23 @@ public:
      * for more information about the version check functionality.
      *
      * \details
+     *
+     * The parser takes ownership of `arguments`. The arguments are not copied again, neither for parsing nor
+     * for \link subcommand_parse sub-parsers \endlink.
+     *
      * \stableapi{Since version 1.0.}
      */
     parser(std::string app_name,
            std::vector<std::string> arguments,
            update_notifications version_updates = update_notifications::on,
            std::vector<std::string> const & subcommands = {}) :
-        version_check_dev_decision{version_updates},
-        arguments{std::move(arguments)}
+        version_check_dev_decision{SHARG_DISABLE_VERSION_CHECK ? update_notifications::off : version_updates},
+        argument_storage{store_arguments(std::move(arguments))},
+        arguments{argument_storage->views}
     {
         add_subcommands(subcommands);
         info.app_name = std::move(app_name);
+        detail::trace_recorder::instance().record("parser construction", {}, construction_start);
     }
 
     //!\overload
@@ -202,13 +230,34 @@ public:
         parser{std::move(app_name), std::vector<std::string>{argv, argv + argc}, version_updates, subcommands}
     {}
 
-    //!\brief The destructor.
-    ~parser()
+    /*!\overload
+     * \details
+     *
+     * The parser does not copy the strings pointed to by `argv`, i.e. `argv` must outlive the parser.
+     * This is always the case for the `argv` passed to `main`.
+     *
+     * \experimentalapi{Experimental since version 1.2.3.}
+     */
+    parser(borrow_arguments_t,
+           std::string app_name,
+           int const argc,
+           char const * const * const argv,
+           update_notifications version_updates = update_notifications::on,
+           std::vector<std::string> const & subcommands = {}) :
+        version_check_dev_decision{SHARG_DISABLE_VERSION_CHECK ? update_notifications::off : version_updates},
+        argument_storage{refer_to_arguments(argc, argv)},
+        arguments{argument_storage->views}
     {
-        // wait for another 3 seconds
-        if (version_check_future.valid())
-            version_check_future.wait_for(std::chrono::seconds(3));
+        add_subcommands(subcommands);
+        info.app_name = std::move(app_name);
+        detail::trace_recorder::instance().record("parser construction", {}, construction_start);
     }
+
+    /*!\brief The destructor.
+     * \details
+     * Does not wait for the version check, which runs in a separate process and is not interrupted by exiting.
+     */
+    ~parser() = default;
     //!\}
 
     /*!\name Adding options
@@ -245,19 +294,9 @@ public:
     void add_option(option_type & value, config<validator_type> const & config)
     {
         check_parse_not_called("add_option");
-        verify_option_config(config);
+        verify_option_config(config, detail::is_container_option<option_type>);
 
-        auto operation = [this, &value, config]()
-        {
-            auto visit_fn = [&value, &config](auto & f)
-            {
-                f.add_option(value, config);
-            };
-
-            std::visit(std::move(visit_fn), format);
-        };
-
-        operations.push_back(std::move(operation));
+        operations.add_option(value, config);
     }
 
     /*!\brief Adds a flag to the sharg::parser.
@@ -278,22 +317,12 @@ public:
     void add_flag(bool & value, config<validator_type> const & config)
     {
         check_parse_not_called("add_flag");
-        verify_flag_config(config);
+        verifier.verify_flag_config(config);
 
         if (value)
             throw design_error("A flag's default value must be false.");
 
-        auto operation = [this, &value, config]()
-        {
-            auto visit_fn = [&value, &config](auto & f)
-            {
-                f.add_flag(value, config);
-            };
-
-            std::visit(std::move(visit_fn), format);
-        };
-
-        operations.push_back(std::move(operation));
+        operations.add_flag(value, config);
     }
 
     /*!\brief Adds a positional option to the sharg::parser.
@@ -329,25 +358,85 @@ public:
     void add_positional_option(option_type & value, config<validator_type> const & config)
     {
         check_parse_not_called("add_positional_option");
-        verify_positional_option_config(config);
-
-        if constexpr (detail::is_container_option<option_type>)
-            has_positional_list_option = true; // keep track of a list option because there must be only one!
+        verifier.verify_positional_option_config(config,
+                                                 detail::is_container_option<option_type>,
+                                                 !subcommands.empty());
 
-        auto operation = [this, &value, config]()
-        {
-            auto visit_fn = [&value, &config](auto & f)
-            {
-                f.add_positional_option(value, config);
-            };
+        operations.add_positional_option(value, config);
+    }
 
-            std::visit(std::move(visit_fn), format);
-        };
+    /*!\brief Adds a positional list option whose values are passed to a sink one at a time instead of being stored.
+     *
+     * \tparam value_type The type of a single value. Must model sharg::parsable and must not be a container.
+     * \tparam sink_type A type that is invocable with a `value_type` or an output iterator for `value_type`.
+     * \tparam validator_type The type of validator to be applied to each value. Must model sharg::validator.
+     *
+     * \param[in] sink   The sink that receives the values. It is moved into the parser.
+     * \param[in] config Customise the sharg::parser behaviour. See sharg::positional_config.
+     *
+     * \throws sharg::design_error if sharg::parser::parse was already called.
+     * \throws sharg::design_error if the option has a short or long identifier.
+     * \throws sharg::design_error if the option is advanced or hidden.
+     * \throws sharg::design_error if the option has a default_message.
+     * \throws sharg::design_error if there already is a positional list option.
+     * \throws sharg::design_error if there are subcommands.
+     *
+     * \details
+     *
+     * The option behaves like a positional option of type `std::vector<value_type>`: It must be the last positional
+     * option, takes all remaining positional arguments, and is shown as a list on the help page.
+     * Instead of storing all values before validating the whole container, each argument is parsed, validated and
+     * passed to the sink before the next argument is parsed. Hence, the memory needed for the values does not
+     * depend on the number of arguments, and an application can start processing values during
+     * sharg::parser::parse. All options and flags have already been parsed when the sink receives the first value.
+     *
+     * The `config.validator` must be applicable to a single `value_type`. If a value cannot be parsed or is not
+     * valid, sharg::parser::parse throws. The sink has then received all values before the invalid one.
+     *
+     * \include test/snippet/positional_option_sink.cpp
+     *
+     * \experimentalapi{Experimental since version 1.2.3.}
+     */
+    template <typename value_type, typename sink_type, typename validator_type>
+        requires parsable<value_type> && (!detail::is_container_option<value_type>)
+              && detail::positional_sink<sink_type, value_type> && std::invocable<validator_type, value_type>
+    void add_positional_option_sink(sink_type sink, config<validator_type> const & config)
+    {
+        check_parse_not_called("add_positional_option_sink");
+        // the sink takes all remaining arguments, like a list option
+        verifier.verify_positional_option_config(config, true, !subcommands.empty());
 
-        operations.push_back(std::move(operation));
+        operations.template add_positional_option_sink<value_type>(std::move(sink), config);
     }
     //!\}
 
+    /*!\brief Enables the expansion of response files, i.e. `@file` arguments.
+     * \param[in] mode How to split the contents of a response file into arguments.
+     *                 sharg::response_file_mode::off (default) disables the expansion.
+     * \throws sharg::design_error if sharg::parser::parse was already called.
+     *
+     * \details
+     *
+     * Each argument `@file` is replaced by the arguments contained in `file` before the command line is processed.
+     * Hence, the contained arguments behave exactly like arguments given on the command line, e.g. they may be
+     * options, `--help` or a \link subcommand_parse subcommand\endlink.
+     *
+     * - Response files may contain `@file` arguments, which are expanded recursively. A response file that
+     *   (indirectly) includes itself results in a sharg::user_input_error.
+     * - Arguments after `--`, which may also be contained in a response file, are not expanded.
+     * - Relative paths are resolved against the current working directory.
+     * - A response file that cannot be read results in a sharg::user_input_error when calling sharg::parser::parse.
+     *
+     * It is sufficient to set the mode for the top-level parser. The sub-parser receives the expanded arguments.
+     *
+     * \experimentalapi{Experimental since version 1.2.3.}
+     */
+    void set_response_file_mode(response_file_mode const mode)
+    {
+        check_parse_not_called("set_response_file_mode");
+        response_files = mode;
+    }
+
     /*!\brief Initiates the actual command line parsing.
      *
      * \attention The function must be called at the very end of all parser
@@ -361,6 +450,8 @@ public:
      * \throws sharg::too_many_arguments if the command line call contained more arguments than expected.
      * \throws sharg::too_few_arguments if the command line call contained less arguments than expected.
      * \throws sharg::validation_error if the argument was not excepted by the provided validator.
+     * \throws sharg::user_input_error if a response file cannot be read, includes itself or contains an unterminated
+     *         quote (see sharg::parser::set_response_file_mode).
      *
      * \details
      *
@@ -421,22 +512,44 @@ public:
             throw design_error("The function parse() must only be called once!");
 
         parse_was_called = true;
+        SHARG_PROBE1(parse_start, info.app_name.c_str());
 
         // User input sanitization must happen before version check!
-        verify_app_and_subcommand_names();
+        {
+            detail::trace_span span{"verify_app_and_subcommand_names"};
+            verify_app_and_subcommand_names();
+        }
+
+        // Replace @file arguments by the contents of the response files.
+        {
+            detail::trace_span span{"expand_response_files"};
+            expand_response_files();
+        }
 
         // Determine the format and subcommand.
-        determine_format_and_subcommand();
+        {
+            detail::trace_span span{"determine_format_and_subcommand"};
+            determine_format_and_subcommand();
+        }
 
         // Apply all defered operations to the parser, e.g., `add_option`, `add_flag`, `add_positional_option`.
-        for (auto & operation : operations)
-            operation();
+        {
+            detail::trace_span span{"operations"};
+            operations.add_to(format);
+        }
 
+#if !SHARG_DISABLE_VERSION_CHECK
         // The version check, which might exit the program, must be called before calling parse on the format.
         run_version_check();
+#endif
 
         // Parse the command line arguments.
-        parse_format();
+        {
+            detail::trace_span span{"parse_format"};
+            parse_format();
+        }
+
+        SHARG_PROBE1(parse_end, info.app_name.c_str());
 
         // Exit after parsing any special format.
         if (!std::holds_alternative<detail::format_parse>(format))
@@ -486,6 +599,9 @@ public:
      *   via `sharg::parser::add_option()` calls beforehand.
      *
      * \details
+     *
+     * Whether an option was set is recorded while parsing, i.e. this function takes constant time.
+     *
      * \stableapi{Since version 1.0.}
      */
     // clang-format off
@@ -493,6 +609,39 @@ public:
         requires std::same_as<id_type, char> || std::constructible_from<std::string, id_type>
     bool is_option_set(id_type const & id) const
     // clang-format on
+    {
+        return !option_positions(id).empty();
+    }
+
+    /*!\brief Returns the positions on the command line at which the option identifier (`id`) was set by the user.
+     * \tparam id_type Either type `char` or a type that a `std::string` is constructible from.
+     * \param[in] id The short (`char`) or long (`std::string`) option identifier to search for.
+     * \returns The positions of the arguments containing the option, in command line order. The size is the number of
+     *          times the option was set.
+     * \throws sharg::design_error if the function is used incorrectly (see sharg::parser::is_option_set).
+     *
+     * \details
+     *
+     * Position `0` is the name of the executable (or of the subcommand for a sub-parser) and the positions refer to the
+     * command line after response files were expanded. An argument containing a value, e.g. `-i3` or `--id=3`, is
+     * counted as one position; for `-i 3`, the position of `-i` is returned. This can be used for precise error
+     * messages:
+     *
+     * ```cpp
+     * if (std::span<size_t const> positions = parser.option_positions('i'); positions.size() > 1u)
+     *     std::cerr << "Option -i is given again at argument " << positions[1] << ".\n";
+     * ```
+     *
+     * The positions are recorded while parsing, i.e. this function takes constant time. All options and flags that
+     * were added to the parser can be queried; the special options of the parser, e.g. `--help`, are never set.
+     *
+     * \experimentalapi{Experimental since version 1.2.3.}
+     */
+    // clang-format off
+    template <typename id_type>
+        requires std::same_as<id_type, char> || std::constructible_from<std::string, id_type>
+    std::span<size_t const> option_positions(id_type const & id) const
+    // clang-format on
     {
         if (!parse_was_called)
             throw design_error{"You can only ask which options have been set after calling the function `parse()`."};
@@ -506,14 +655,12 @@ public:
                                  " (\"\")!"};
         }
 
-        auto const it = detail::id_pair::find(used_option_ids, id_pair);
-        if (it == used_option_ids.end())
+        if (!verifier.used_ids().contains(id_pair))
             throw design_error{"You can only ask for option identifiers that you added with add_option() before."};
 
-        // we only need to search for an option before the `option_end_identifier` (`--`)
-        auto option_end = std::ranges::find(format_arguments, option_end_identifier);
-        auto option_it = detail::format_parse::find_option_id(format_arguments.begin(), option_end, *it);
-        return option_it != option_end;
+        // Only format_parse records options; all other formats exit in parse().
+        detail::format_parse const * const parsed = std::get_if<detail::format_parse>(&format);
+        return parsed ? parsed->positions(id_pair) : std::span<size_t const>{};
     }
 
     //!\name Structuring the Help Page
@@ -533,17 +680,7 @@ public:
     {
         check_parse_not_called("add_section");
 
-        auto operation = [this, title, advanced_only]()
-        {
-            auto visit_fn = [&title, advanced_only](auto & f)
-            {
-                f.add_section(title, advanced_only);
-            };
-
-            std::visit(std::move(visit_fn), format);
-        };
-
-        operations.push_back(std::move(operation));
+        operations.add_section(title, advanced_only);
     }
 
     /*!\brief Adds an help page subsection to the sharg::parser.
@@ -560,17 +697,7 @@ public:
     {
         check_parse_not_called("add_subsection");
 
-        auto operation = [this, title, advanced_only]()
-        {
-            auto visit_fn = [&title, advanced_only](auto & f)
-            {
-                f.add_subsection(title, advanced_only);
-            };
-
-            std::visit(std::move(visit_fn), format);
-        };
-
-        operations.push_back(std::move(operation));
+        operations.add_subsection(title, advanced_only);
     }
 
     /*!\brief Adds an help page text line to the sharg::parser.
@@ -588,17 +715,7 @@ public:
     {
         check_parse_not_called("add_line");
 
-        auto operation = [this, text, is_paragraph, advanced_only]()
-        {
-            auto visit_fn = [&text, is_paragraph, advanced_only](auto & f)
-            {
-                f.add_line(text, is_paragraph, advanced_only);
-            };
-
-            std::visit(std::move(visit_fn), format);
-        };
-
-        operations.push_back(std::move(operation));
+        operations.add_line(text, is_paragraph, advanced_only);
     }
 
     /*!\brief Adds an help page list item (key-value) to the sharg::parser.
@@ -625,17 +742,7 @@ public:
     {
         check_parse_not_called("add_list_item");
 
-        auto operation = [this, key, desc, advanced_only]()
-        {
-            auto visit_fn = [&key, &desc, advanced_only](auto & f)
-            {
-                f.add_list_item(key, desc, advanced_only);
-            };
-
-            std::visit(std::move(visit_fn), format);
-        };
-
-        operations.push_back(std::move(operation));
+        operations.add_list_item(key, desc, advanced_only);
     }
 
     /*!\brief Adds subcommands to the parser.
@@ -716,26 +823,24 @@ private:
     //!\brief Keeps track of whether the parse function has been called already.
     bool parse_was_called{false};
 
-    //!\brief Keeps track of whether the user has added a positional list option to check if this was the very last.
-    bool has_positional_list_option{false};
+    //!\brief The start of the construction for sharg::detail::trace_recorder. Initialised before the arguments.
+    int64_t construction_start{detail::trace_recorder::instance().now()};
 
     //!\brief Set on construction and indicates whether the developer deactivates the version check calls completely.
     update_notifications version_check_dev_decision{};
 
+#if !SHARG_DISABLE_VERSION_CHECK
     //!\brief Whether the **user** specified to perform the version check (true) or not (false), default unset.
     std::optional<bool> version_check_user_decision;
+#endif
 
     //!\brief Befriend sharg::detail::test_accessor to grant access to version_check_future and format.
     friend struct ::sharg::detail::test_accessor;
 
+#if !SHARG_DISABLE_VERSION_CHECK
     //!\brief The future object that keeps track of the detached version check call thread.
     std::future<bool> version_check_future;
-
-    //!\brief Validates the application name to ensure an escaped server call.
-    std::regex app_name_regex{"^[a-zA-Z0-9_-]+$"};
-
-    //!\brief Signals the parser that no options follow this string but only positional arguments.
-    static constexpr std::string_view const option_end_identifier{"--"};
+#endif
 
     //!\brief Stores the sub-parser in case \link subcommand_parse subcommand parsing \endlink is enabled.
     std::unique_ptr<parser> sub_parser{nullptr};
@@ -760,28 +865,46 @@ private:
                  detail::format_copyright>
         format{detail::format_short_help{}};
 
-    //!\brief List of option/flag identifiers that are already used.
-    std::unordered_set<detail::id_pair> used_option_ids{{'h', "help"},
-                                                        {'\0' /*hh*/, "advanced-help"},
-                                                        {'\0', "hh"},
-                                                        {'\0', "export-help"},
-                                                        {'\0', "version"},
-                                                        {'\0', "copyright"}};
+    //!\brief The type of parser::format.
+    using format_type = decltype(format);
+
+    //!\brief Verifies the added options and keeps track of the used identifiers.
+    detail::config_verifier verifier{};
+
+    //!\brief Stores the command line arguments; shared between a parser and its sub-parsers.
+    struct argument_storage_type
+    {
+        std::vector<std::string> owned{};      //!< The arguments if they were passed as std::vector<std::string>.
+        std::vector<std::string_view> views{}; //!< Views on `owned`, the `argv` passed on construction or `base`.
+        //!\brief The storage the arguments were expanded from if response files were expanded.
+        std::shared_ptr<argument_storage_type const> base{};
+        //!\brief The contents of the expanded response files.
+        detail::response_file_storage response_file_contents{};
+    };
+
+    //!\brief How response files are expanded.
+    response_file_mode response_files{response_file_mode::off};
+
+    //!\brief Keeps the command line arguments alive. Shared with the sub-parser.
+    std::shared_ptr<argument_storage_type const> argument_storage{};
+
+    //!\brief The original command line arguments. A sub-parser refers to the tail of its parent's arguments.
+    std::span<std::string_view const> arguments{};
 
     //!\brief The command line arguments that will be passed to the format.
-    std::vector<std::string> format_arguments{};
+    std::vector<std::string_view> format_arguments{};
 
-    //!\brief The original command line arguments.
-    std::vector<std::string> arguments{};
+    //!\brief The position in parser::arguments of each of parser::format_arguments.
+    std::vector<size_t> format_argument_positions{};
 
     //!\brief The command that lead to calling this parser, e.g. [./build/bin/raptor, build]
     std::vector<std::string> executable_name{};
 
     //!\brief Set of option identifiers (including -/--) that have been added via `add_option`.
-    std::unordered_set<std::string> options{};
+    std::unordered_set<std::string, detail::string_hash, std::equal_to<>> options{};
 
-    //!\brief Vector of functions that stores all calls.
-    std::vector<std::function<void()>> operations;
+    //!\brief Stores all calls to add options and help page elements until the format is known.
+    detail::option_table<format_type> operations;
 
     /*!\brief Handles format and subcommand detection.
      * \throws sharg::too_few_arguments if option --export-help was specified without a value
@@ -819,6 +942,13 @@ private:
 
         executable_name.emplace_back(arg);
 
+        // Helper function for passing the current argument to the format.
+        auto forward_arg = [this, &it, &arg]()
+        {
+            format_arguments.emplace_back(arg);
+            format_argument_positions.push_back(static_cast<size_t>(it - arguments.begin()));
+        };
+
         // Helper function for reading the next argument. This makes it more obvious that we are
         // incrementing `it` (version-check, and export-help).
         auto read_next_arg = [this, &it, &arg]() -> bool
@@ -852,9 +982,13 @@ private:
 
             if (std::ranges::find(subcommands, arg) != subcommands.end())
             {
-                sub_parser = std::make_unique<parser>(info.app_name + "-" + arg.data(),
-                                                      std::vector<std::string>{it, arguments.end()},
+                sub_parser = std::make_unique<parser>(info.app_name + "-" + std::string{arg},
+                                                      std::vector<std::string>{},
                                                       update_notifications::off);
+                SHARG_PROBE1(sub_parser_create, sub_parser->info.app_name.c_str());
+                // The sub-parser shares the arguments instead of copying them.
+                sub_parser->argument_storage = argument_storage;
+                sub_parser->arguments = std::span{it, arguments.end()};
                 copy_metadata_to_subparser(get_sub_parser());
 
                 // Add the original calls to the front, e.g. ["raptor"],
@@ -887,15 +1021,15 @@ private:
         for (; read_next_arg();)
         {
             // The argument is a known option.
-            if (options.contains(std::string{arg}))
+            if (options.contains(arg))
             {
                 // No futher checks are needed.
-                format_arguments.emplace_back(arg);
+                forward_arg();
 
                 // Consume the next argument (the option value) if possible.
                 if (read_next_arg())
                 {
-                    format_arguments.emplace_back(arg);
+                    forward_arg();
                     continue;
                 }
                 else // Too few arguments. This is handled by format_parse.
@@ -952,6 +1086,7 @@ private:
                                            "Value must be one of "
                                            + detail::supported_exports + "."};
             }
+#if !SHARG_DISABLE_VERSION_CHECK
             else if (arg == "--version-check")
             {
                 if (!read_next_arg())
@@ -964,10 +1099,11 @@ private:
                 else
                     throw validation_error{"Value for option --version-check must be true (1) or false (0)."};
             }
+#endif
             else
             {
                 // Flags, positional options, options using an alternative syntax (--optionValue, --option=value), etc.
-                format_arguments.emplace_back(arg);
+                forward_arg();
             }
         }
 
@@ -978,97 +1114,65 @@ private:
         // All special options have been handled. If there are arguments left or we have a subparser,
         // we call format_parse. Oterhwise, we print the short help (default variant).
         if (!format_arguments.empty() || sub_parser)
-            format = detail::format_parse(format_arguments);
+            format = detail::format_parse(format_arguments, format_argument_positions);
     }
 
-    /*!\brief Verifies that the short and the long identifiers are correctly formatted.
-     * \param[in] short_id The short identifier of the command line option/flag.
-     * \param[in] long_id  The long identifier of the command line option/flag.
-     * \throws sharg::design_error
-     * \details Specifically, checks that identifiers haven't been used before,
-     *          the length of long IDs is either empty or longer than one char,
-     *          the characters used in the identifiers are all valid,
-     *          and at least one of short_id or long_id is given.
+    /*!\brief Replaces each `@file` argument by the arguments contained in the response file.
+     * \throws sharg::user_input_error if a response file cannot be read, includes itself or contains an unterminated
+     *         quote.
+     * \details
+     * The expanded arguments refer to the unexpanded storage, which is therefore kept alive.
+     * A sub-parser shares the already expanded arguments and does not expand them again.
      */
-    void verify_identifiers(char const short_id, std::string const & long_id)
+    void expand_response_files()
     {
-        auto is_valid = [](char const c) -> bool
-        {
-            return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') // alphanumeric
-                || c == '@' || c == '_' || c == '-';                                          // additional characters
-        };
+        if (response_files == response_file_mode::off || argument_storage->base != nullptr)
+            return;
 
-        if (short_id == '\0' && long_id.empty())
-            throw design_error{"Short and long identifiers may not both be empty."};
+        auto storage = std::make_shared<argument_storage_type>();
+        storage->base = argument_storage;
+        detail::response_file_expander expander{response_files, storage->response_file_contents};
+        storage->views = expander.expand(arguments);
 
-        if (short_id != '\0')
-        {
-            if (short_id == '-' || !is_valid(short_id))
-                throw design_error{"Short identifiers may only contain alphanumeric characters, '_', or '@'."};
-            if (detail::id_pair::contains(used_option_ids, short_id))
-                throw design_error{"Short identifier '" + std::string(1, short_id) + "' was already used before."};
-        }
+        argument_storage = std::move(storage);
+        arguments = argument_storage->views;
+    }
 
-        if (!long_id.empty())
-        {
-            if (long_id.size() == 1)
-                throw design_error{"Long identifiers must be either empty or longer than one character."};
-            if (long_id[0] == '-')
-                throw design_error{"Long identifiers may not use '-' as first character."};
-            if (!std::ranges::all_of(long_id, is_valid))
-                throw design_error{"Long identifiers may only contain alphanumeric characters, '_', '-', or '@'."};
-            if (detail::id_pair::contains(used_option_ids, long_id))
-                throw design_error{"Long identifier '" + long_id + "' was already used before."};
-        }
+    /*!\brief Takes ownership of the given arguments.
+     * \param[in] arguments The command line arguments.
+     * \returns The storage owning `arguments`.
+     */
+    static std::shared_ptr<argument_storage_type const> store_arguments(std::vector<std::string> arguments)
+    {
+        auto storage = std::make_shared<argument_storage_type>();
+        storage->owned = std::move(arguments);
+        storage->views.assign(storage->owned.begin(), storage->owned.end());
+        return storage;
+    }
 
-        used_option_ids.emplace(short_id, long_id);
+    /*!\brief Refers to the given arguments without copying the strings.
+     * \param[in] argc The number of command line arguments.
+     * \param[in] argv The command line arguments; must outlive the parser.
+     * \returns The storage referring to `argv`.
+     */
+    static std::shared_ptr<argument_storage_type const> refer_to_arguments(int const argc,
+                                                                           char const * const * const argv)
+    {
+        auto storage = std::make_shared<argument_storage_type>();
+        storage->views.assign(argv, argv + argc);
+        return storage;
     }
 
     //!brief Verify the configuration given to a sharg::parser::add_option call.
     template <typename validator_t>
-    void verify_option_config(config<validator_t> const & config)
+    void verify_option_config(config<validator_t> const & config, bool const is_list)
     {
-        verify_identifiers(config.short_id, config.long_id);
+        verifier.verify_option_config(config, is_list);
 
         if (config.short_id != '\0')
             options.emplace(std::string{"-"} + config.short_id);
         if (!config.long_id.empty())
             options.emplace(std::string{"--"} + config.long_id);
-
-        if (config.required && !config.default_message.empty())
-            throw design_error{"A required option cannot have a default message."};
-    }
-
-    //!brief Verify the configuration given to a sharg::parser::add_flag call.
-    template <typename validator_t>
-    void verify_flag_config(config<validator_t> const & config)
-    {
-        verify_identifiers(config.short_id, config.long_id);
-
-        if (!config.default_message.empty())
-            throw design_error{"A flag may not have a default message because the default is always `false`."};
-    }
-
-    //!brief Verify the configuration given to a sharg::parser::add_positional_option call.
-    template <typename validator_t>
-    void verify_positional_option_config(config<validator_t> const & config) const
-    {
-        if (config.short_id != '\0' || config.long_id != "")
-            throw design_error{"Positional options are identified by their position on the command line. "
-                               "Short or long ids are not permitted!"};
-
-        if (config.advanced || config.hidden)
-            throw design_error{"Positional options are always required and therefore cannot be advanced nor hidden!"};
-
-        if (!subcommands.empty())
-            throw design_error{"You may only specify flags and options for the top-level parser."};
-
-        if (has_positional_list_option)
-            throw design_error{"You added a positional option with a list value before so you cannot add "
-                               "any other positional options."};
-
-        if (!config.default_message.empty())
-            throw design_error{"A positional option may not have a default message because it is always required."};
     }
 
     /*!\brief Throws a sharg::design_error if parse() was already called.
@@ -1097,7 +1201,7 @@ private:
     {
         // Before creating the detail::version_checker, we have to make sure that
         // malicious code cannot be injected through the app name.
-        if (!std::regex_match(info.app_name, app_name_regex))
+        if (!detail::app_name_chars.matches(info.app_name))
         {
             throw design_error{("The application name must only contain alpha-numeric characters or '_' and '-' "
                                 "(regex: \"^[a-zA-Z0-9_-]+$\").")};
@@ -1105,7 +1209,7 @@ private:
 
         for (auto & sub : this->subcommands)
         {
-            if (!std::regex_match(sub, app_name_regex))
+            if (!detail::app_name_chars.matches(sub))
             {
                 throw design_error{"The subcommand name must only contain alpha-numeric characters or '_' and '-' "
                                    "(regex: \"^[a-zA-Z0-9_-]+$\")."};
@@ -1113,6 +1217,7 @@ private:
         }
     }
 
+#if !SHARG_DISABLE_VERSION_CHECK
     /*!\brief Runs the version check if the user has not disabled it.
      * \details
      * If the user has not disabled the version check, the function will start a detached thread that will call the
@@ -1121,8 +1226,15 @@ private:
     inline void run_version_check()
     {
         detail::version_checker app_version{info.app_name, info.version, info.url};
+        bool perform_check{};
+
+        {
+            detail::trace_span span{"version check decision"};
+            perform_check =
+                app_version.decide_if_check_is_performed(version_check_dev_decision, version_check_user_decision);
+        }
 
-        if (app_version.decide_if_check_is_performed(version_check_dev_decision, version_check_user_decision))
+        if (perform_check)
         {
             // must be done before calling parse on the format because this might std::exit
             std::promise<bool> app_version_prom;
@@ -1130,6 +1242,7 @@ private:
             app_version(std::move(app_version_prom));
         }
     }
+#endif
 
     /*!\brief Parses the command line arguments according to the format.
      * \throws sharg::option_declared_multiple_times if an option that is not a list was declared multiple times.
@@ -0,0 +1,165 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \author Enrico Seiler <enrico.seiler AT fu-berlin.de>
+ * \brief Provides sharg::parser_schema.
+ */
+
+#pragma once
+
+#include <memory>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#include <sharg/detail/config_verifier.hpp>
+#include <sharg/detail/format_parse.hpp>
+
+namespace sharg
+{
+
+/*!\brief Holds the options of an application once and parses any number of command lines, also concurrently.
+ * \ingroup parser
+ * \tparam options_t The type whose members store the values of the options.
+ *
+ * \details
+ *
+ * A sharg::parser binds its options to variables and parses a single command line. A sharg::parser_schema binds its
+ * options to members of `options_t` and parses any number of command lines. Each call to
+ * sharg::parser_schema::parse returns a new `options_t{}` that contains the values given on the command line.
+ * The options, their validators and the lookup table of the identifiers are set up once when adding the options.
+ *
+ * \include test/snippet/parser_schema.cpp
+ *
+ * ### Thread safety
+ *
+ * Adding an option modifies the schema and must not be done concurrently with any other call. Afterwards, the schema
+ * is not modified anymore, i.e. sharg::parser_schema::parse can be called concurrently from any number of threads.
+ * The validators of the options are then also called concurrently.
+ *
+ * ### Differences to sharg::parser
+ *
+ * The options are configured and verified exactly like for a sharg::parser. However, the schema only parses
+ * options, flags and positional options. It does not support subcommands, response files, help pages or the version
+ * check. The special options, e.g. `--help` or `--version`, are unknown options.
+ *
+ * \experimentalapi{Experimental since version 1.2.3.}
+ */
+template <typename options_t>
+    requires std::default_initializable<options_t> && std::move_constructible<options_t>
+class parser_schema
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    parser_schema() = default;                                 //!< Defaulted.
+    parser_schema(parser_schema const &) = delete;             //!< Deleted.
+    parser_schema & operator=(parser_schema const &) = delete; //!< Deleted.
+    parser_schema(parser_schema &&) = default;                 //!< Defaulted.
+    parser_schema & operator=(parser_schema &&) = default;     //!< Defaulted.
+    ~parser_schema() = default;                                //!< Defaulted.
+    //!\}
+
+    /*!\name Adding options
+     * \brief Add (positional) options and flags to the schema.
+     * \{
+     */
+    /*!\brief Adds an option whose value is stored in `member`.
+     * \tparam option_type    See sharg::parser::add_option.
+     * \tparam validator_type The type of validator to be applied to the option value. Must model sharg::validator.
+     * \param[in] member The member of `options_t` in which to store the given command line argument.
+     * \param[in] config A configuration object to customise the parsing behaviour. See sharg::config.
+     * \throws sharg::design_error if the option identifier was already used or is not a valid identifier.
+     * \throws sharg::design_error if the option is required and has a default_message.
+     */
+    template <typename option_type, typename validator_type>
+        requires (parsable<option_type> || parsable<std::ranges::range_value_t<option_type>>)
+              && std::invocable<validator_type, option_type>
+    void add_option(option_type options_t::* const member, config<validator_type> const & config)
+    {
+        verifier.verify_option_config(config, detail::is_container_option<option_type>);
+        prototype.add_option(store(member, config));
+    }
+
+    /*!\brief Adds a flag whose value is stored in `member`.
+     * \param[in] member The member of `options_t` which shows if the flag is turned off (default) or on.
+     * \param[in] config A configuration object to customise the parsing behaviour. See sharg::config.
+     * \throws sharg::design_error if the member is `true` in `options_t{}`.
+     * \throws sharg::design_error if the option identifier was already used or is not a valid identifier.
+     */
+    template <typename validator_type>
+        requires std::invocable<validator_type, bool>
+    void add_flag(bool options_t::* const member, config<validator_type> const & config)
+    {
+        verifier.verify_flag_config(config);
+
+        if (options_t{}.*member)
+            throw design_error("A flag's default value must be false.");
+
+        prototype.add_flag(store(member, config));
+    }
+
+    /*!\brief Adds a positional option whose value is stored in `member`.
+     * \tparam option_type    See sharg::parser::add_positional_option.
+     * \tparam validator_type The type of validator to be applied to the option value. Must model sharg::validator.
+     * \param[in] member The member of `options_t` in which to store the given command line argument.
+     * \param[in] config Customise the parsing behaviour. See sharg::positional_config.
+     * \throws sharg::design_error if the option has a short or long identifier.
+     * \throws sharg::design_error if the option is advanced or hidden.
+     * \throws sharg::design_error if the option has a default_message.
+     * \throws sharg::design_error if there already is a positional list option.
+     */
+    template <typename option_type, typename validator_type>
+        requires (parsable<option_type> || parsable<std::ranges::range_value_t<option_type>>)
+              && std::invocable<validator_type, option_type>
+    void add_positional_option(option_type options_t::* const member, config<validator_type> const & config)
+    {
+        verifier.verify_positional_option_config(config, detail::is_container_option<option_type>, false);
+        prototype.add_positional_option(store(member, config));
+    }
+    //!\}
+
+    /*!\brief Parses a command line.
+     * \param[in] arguments The command line arguments, without the name of the executable.
+     * \returns The options given on the command line; all other members are as in `options_t{}`.
+     * \throws sharg::parser_error if the command line is invalid. See sharg::parser::parse for the derived exceptions.
+     *
+     * \details
+     *
+     * The arguments are not modified and only need to be valid during the call. May be called concurrently.
+     */
+    options_t parse(std::span<std::string_view const> const arguments) const
+    {
+        options_t result{};
+        detail::format_parse format{prototype, arguments, &result};
+        format.parse();
+        return result;
+    }
+
+private:
+    //!\brief Verifies the added options and keeps track of the used identifiers.
+    detail::config_verifier verifier{};
+
+    //!\brief The added options; each format_parse constructed in sharg::parser_schema::parse refers to them.
+    detail::format_parse prototype{std::span<std::string_view const>{}};
+
+    //!\brief Owns the members and configurations of the options; their addresses are stable.
+    std::vector<std::shared_ptr<void const>> bindings{};
+
+    //!\brief Stores the member and the configuration of an option and returns the stored binding.
+    template <typename value_type, typename validator_type>
+    detail::member_binding<options_t, value_type, validator_type> const &
+    store(value_type options_t::* const member, config<validator_type> const & config)
+    {
+        using binding_t = detail::member_binding<options_t, value_type, validator_type>;
+
+        auto binding = std::make_shared<binding_t const>(binding_t{member, config});
+        bindings.push_back(binding);
+        return *binding;
+    }
+};
+
+} // namespace sharg
@@ -83,6 +83,21 @@
 #    error "Sharg include directory not set correctly. Forgot to add -I ${INSTALLDIR}/include to your CXXFLAGS?"
 #endif
 
+// ============================================================================
+//  Update notifications
+// ============================================================================
+
+/*!\def SHARG_DISABLE_VERSION_CHECK
+ * \brief Whether the update notifications are compiled out.
+ * \details
+ * If set to `1`, the sharg::parser neither includes nor runs the version check and does not know the option
+ * `--version-check`, regardless of sharg::update_notifications. Set by the CMake option `SHARG_DISABLE_VERSION_CHECK`.
+ * Defaults to `0`.
+ */
+#ifndef SHARG_DISABLE_VERSION_CHECK
+#    define SHARG_DISABLE_VERSION_CHECK 0
+#endif
+
 // ============================================================================
 //  Documentation
 // ============================================================================
@@ -0,0 +1,666 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \author Enrico Seiler <enrico.seiler AT fu-berlin.de>
+ * \brief Provides sharg::static_schema.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <span>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <sharg/detail/config_verifier.hpp>
+#include <sharg/detail/fixed_string.hpp>
+#include <sharg/detail/value_parser.hpp>
+#include <sharg/enumeration_table.hpp>
+
+namespace sharg::detail
+{
+
+//!\brief Whether a sharg::detail::static_option_descriptor describes an option, a flag or a positional option.
+//!\ingroup parser
+enum class static_option_kind : uint8_t
+{
+    option,           //!< An option, see sharg::static_option.
+    flag,             //!< A flag, see sharg::static_flag.
+    positional_option //!< A positional option, see sharg::static_positional_option.
+};
+
+/*!\brief An option, flag or positional option of a sharg::static_schema.
+ * \ingroup parser
+ * \tparam option_kind      Whether this is an option, a flag or a positional option.
+ * \tparam short_identifier The short identifier; `'\0'` if there is none.
+ * \tparam long_identifier  The long identifier; empty if there is none.
+ * \tparam object_t         The type whose member stores the value.
+ * \tparam value_t          The type of the member.
+ * \tparam validator_t      The type of the validator.
+ */
+template <static_option_kind option_kind,
+          char short_identifier,
+          fixed_string long_identifier,
+          typename object_t,
+          typename value_t,
+          typename validator_t>
+struct static_option_descriptor
+{
+    //!\brief Whether this is an option, a flag or a positional option.
+    static constexpr static_option_kind kind{option_kind};
+    //!\brief The short identifier; `'\0'` if there is none.
+    static constexpr char short_id{short_identifier};
+    //!\brief The long identifier; empty if there is none.
+    static constexpr std::string_view long_id{long_identifier.view()};
+
+    //!\brief The type whose member stores the value.
+    using object_type = object_t;
+    //!\brief The type of the member.
+    using value_type = value_t;
+
+    value_t object_t::* member;        //!< The member that stores the value.
+    config<validator_t> configuration; //!< The configuration, including the identifiers.
+};
+
+/*!\brief Creates a sharg::detail::static_option_descriptor and sets the identifiers of its configuration.
+ * \throws sharg::design_error if the configuration already contains identifiers.
+ */
+template <static_option_kind kind,
+          char short_id,
+          fixed_string long_id,
+          typename object_t,
+          typename value_t,
+          typename validator_t>
+auto make_static_option_descriptor(value_t object_t::* const member, config<validator_t> configuration)
+{
+    if (configuration.short_id != '\0' || !configuration.long_id.empty())
+        throw design_error{"The identifiers of a static option are given as template arguments, not in its "
+                           "configuration."};
+
+    configuration.short_id = short_id;
+    configuration.long_id = long_id.view();
+
+    return static_option_descriptor<kind, short_id, long_id, object_t, value_t, validator_t>{member,
+                                                                                             std::move(configuration)};
+}
+
+//!\brief Whether `t` is a sharg::detail::static_option_descriptor.
+//!\ingroup parser
+template <typename t>
+inline constexpr bool is_static_option_descriptor = false;
+
+//!\cond
+template <static_option_kind kind, char short_id, fixed_string long_id, typename o, typename v, typename validator_t>
+inline constexpr bool
+    is_static_option_descriptor<static_option_descriptor<kind, short_id, long_id, o, v, validator_t>> =
+    true;
+//!\endcond
+
+} // namespace sharg::detail
+
+namespace sharg
+{
+
+/*!\name Static options
+ * \brief Describe the options, flags and positional options of a sharg::static_schema.
+ * \relates sharg::static_schema
+ * \{
+ */
+/*!\brief Describes an option whose value is stored in `member`.
+ * \tparam short_id       The short identifier, e.g. `'t'` for `-t`; `'\0'` if there is none.
+ * \tparam long_id        The long identifier, e.g. `"threads"` for `--threads`; empty if there is none.
+ * \tparam option_type    See sharg::parser::add_option.
+ * \tparam validator_type The type of validator to be applied to the option value. Must model sharg::validator.
+ * \param[in] member        The member in which to store the given command line argument.
+ * \param[in] configuration See sharg::config. The identifiers are given as template arguments and must be empty.
+ * \throws sharg::design_error if the configuration contains identifiers.
+ * \details
+ * \experimentalapi{Experimental since version 1.2.3.}
+ */
+template <char short_id,
+          detail::fixed_string long_id = "",
+          typename object_type,
+          typename option_type,
+          typename validator_type = detail::default_validator>
+    requires (parsable<option_type> || parsable<std::ranges::range_value_t<option_type>>)
+          && std::invocable<validator_type, option_type>
+auto static_option(option_type object_type::* const member, config<validator_type> configuration = {})
+{
+    return detail::make_static_option_descriptor<detail::static_option_kind::option, short_id, long_id>(
+        member,
+        std::move(configuration));
+}
+
+//!\overload
+template <detail::fixed_string long_id,
+          typename object_type,
+          typename option_type,
+          typename validator_type = detail::default_validator>
+    requires (parsable<option_type> || parsable<std::ranges::range_value_t<option_type>>)
+          && std::invocable<validator_type, option_type>
+auto static_option(option_type object_type::* const member, config<validator_type> configuration = {})
+{
+    return static_option<'\0', long_id>(member, std::move(configuration));
+}
+
+/*!\brief Describes a flag whose value is stored in `member`.
+ * \tparam short_id The short identifier, e.g. `'v'` for `-v`; `'\0'` if there is none.
+ * \tparam long_id  The long identifier, e.g. `"verbose"` for `--verbose`; empty if there is none.
+ * \param[in] member        The member which shows if the flag is turned off (default) or on.
+ * \param[in] configuration See sharg::config. The identifiers are given as template arguments and must be empty.
+ * \throws sharg::design_error if the configuration contains identifiers.
+ * \details
+ * \experimentalapi{Experimental since version 1.2.3.}
+ */
+template <char short_id,
+          detail::fixed_string long_id = "",
+          typename object_type,
+          typename validator_type = detail::default_validator>
+    requires std::invocable<validator_type, bool>
+auto static_flag(bool object_type::* const member, config<validator_type> configuration = {})
+{
+    return detail::make_static_option_descriptor<detail::static_option_kind::flag, short_id, long_id>(
+        member,
+        std::move(configuration));
+}
+
+//!\overload
+template <detail::fixed_string long_id, typename object_type, typename validator_type = detail::default_validator>
+    requires std::invocable<validator_type, bool>
+auto static_flag(bool object_type::* const member, config<validator_type> configuration = {})
+{
+    return static_flag<'\0', long_id>(member, std::move(configuration));
+}
+
+/*!\brief Describes a positional option whose value is stored in `member`.
+ * \tparam option_type    See sharg::parser::add_positional_option.
+ * \tparam validator_type The type of validator to be applied to the option value. Must model sharg::validator.
+ * \param[in] member        The member in which to store the given command line argument.
+ * \param[in] configuration See sharg::config.
+ * \throws sharg::design_error if the configuration contains identifiers.
+ * \details
+ * \experimentalapi{Experimental since version 1.2.3.}
+ */
+template <typename object_type, typename option_type, typename validator_type = detail::default_validator>
+    requires (parsable<option_type> || parsable<std::ranges::range_value_t<option_type>>)
+          && std::invocable<validator_type, option_type>
+auto static_positional_option(option_type object_type::* const member, config<validator_type> configuration = {})
+{
+    return detail::make_static_option_descriptor<detail::static_option_kind::positional_option, '\0', "">(
+        member,
+        std::move(configuration));
+}
+//!\}
+
+/*!\brief Parses command lines whose options are known at compile time.
+ * \ingroup parser
+ * \tparam descriptor_ts The options, flags and positional options; see sharg::static_option, sharg::static_flag and
+ *                       sharg::static_positional_option.
+ *
+ * \details
+ *
+ * Like a sharg::parser_schema, a sharg::static_schema stores the values given on a command line in the members of a
+ * new `options_type{}`. The identifiers of the options and flags are template arguments, and the types of all options
+ * are part of the type of the schema:
+ *
+ * \include test/snippet/static_schema.cpp
+ *
+ * Hence, the identifiers are verified at compile time: Invalid, reserved (e.g. `help`) or duplicate identifiers are
+ * compile errors. The lookup table of the identifiers is computed at compile time, too. Retrieving, parsing and
+ * validating the values is done for each option by code generated for its type and validator, i.e. there are neither
+ * virtual calls nor function pointers, and the compiler can inline the whole parse.
+ *
+ * The configurations are verified on construction, e.g. a required option with a default message throws a
+ * sharg::design_error.
+ *
+ * ### Thread safety
+ *
+ * sharg::static_schema::parse can be called concurrently from any number of threads. The validators of the options
+ * are then also called concurrently.
+ *
+ * ### Differences to sharg::parser
+ *
+ * Parsing behaves exactly like for a sharg::parser_schema, i.e. the schema only parses options, flags and positional
+ * options. It does not support subcommands, response files, help pages or the version check. The special options,
+ * e.g. `--help` or `--version`, are unknown options.
+ *
+ * \experimentalapi{Experimental since version 1.2.3.}
+ */
+template <typename... descriptor_ts>
+    requires (sizeof...(descriptor_ts) > 0u) && (detail::is_static_option_descriptor<descriptor_ts> && ...)
+class static_schema : private detail::value_parser
+{
+public:
+    //!\brief The type whose members store the values of the options.
+    using options_type = typename std::tuple_element_t<0u, std::tuple<descriptor_ts...>>::object_type;
+
+    static_assert((std::same_as<typename descriptor_ts::object_type, options_type> && ...),
+                  "All options of a static_schema must be members of the same type.");
+    static_assert(std::default_initializable<options_type> && std::move_constructible<options_type>,
+                  "The options of a static_schema must be default initializable and move constructible.");
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    static_schema() = delete;                                  //!< Deleted.
+    static_schema(static_schema const &) = default;             //!< Defaulted.
+    static_schema & operator=(static_schema const &) = default; //!< Defaulted.
+    static_schema(static_schema &&) = default;                  //!< Defaulted.
+    static_schema & operator=(static_schema &&) = default;      //!< Defaulted.
+    ~static_schema() = default;                                 //!< Defaulted.
+
+    /*!\brief Constructs the schema from its options.
+     * \param[in] descriptors The options, flags and positional options, in order of evaluation.
+     * \throws sharg::design_error if a configuration is invalid, e.g. a required option has a default message.
+     * \throws sharg::design_error if a flag is `true` in `options_type{}`.
+     */
+    explicit static_schema(descriptor_ts... descriptors) : descriptors{std::move(descriptors)...}
+    {
+        std::apply(
+            [](auto const &... descriptor)
+            {
+                detail::config_verifier verifier{};
+                (verify(verifier, descriptor), ...);
+            },
+            this->descriptors);
+    }
+    //!\}
+
+    /*!\brief Parses a command line.
+     * \param[in] arguments The command line arguments, without the name of the executable.
+     * \returns The options given on the command line; all other members are as in `options_type{}`.
+     * \throws sharg::parser_error if the command line is invalid. See sharg::parser::parse for the derived exceptions.
+     *
+     * \details
+     *
+     * The arguments are not modified and only need to be valid during the call. May be called concurrently.
+     */
+    options_type parse(std::span<std::string_view const> const arguments) const
+    {
+        options_type result{};
+        parse_state state{};
+        state.recorded.reserve(arguments.size());
+        state.positionals.arguments.reserve(arguments.size());
+        tokenize(arguments, tokenize_handler{state}, state.positionals, state.unknown_id);
+        group_occurrences(state);
+
+        [&]<size_t... index>(std::index_sequence<index...>)
+        {
+            // Options first, flags second, positional options last; see sharg::detail::format_parse::parse.
+            (get_option<index>(result, state), ...);
+            (get_flag<index>(result, state), ...);
+            check_for_unknown_ids(state.unknown_id);
+            (get_positional_option<index>(result, state), ...);
+        }(std::index_sequence_for<descriptor_ts...>{});
+
+        check_for_left_over_args(state.positionals);
+        return result;
+    }
+
+private:
+    //!\brief The kind of option.
+    using kind_t = detail::static_option_kind;
+
+    //!\brief The number of options, flags and positional options.
+    static constexpr size_t descriptor_count{sizeof...(descriptor_ts)};
+    //!\brief Marks a position without option.
+    static constexpr size_t npos{descriptor_count};
+
+    //!\brief The kind of each option.
+    static constexpr std::array<kind_t, descriptor_count> kinds{descriptor_ts::kind...};
+    //!\brief The short identifier of each option.
+    static constexpr std::array<char, descriptor_count> short_ids{descriptor_ts::short_id...};
+    //!\brief The long identifier of each option.
+    static constexpr std::array<std::string_view, descriptor_count> long_ids{descriptor_ts::long_id...};
+
+    //!\brief The number of options of kind `kind`.
+    static constexpr size_t count(kind_t const kind)
+    {
+        return static_cast<size_t>(std::ranges::count(kinds, kind));
+    }
+
+    //!\brief The number of options, i.e. not counting flags and positional options.
+    static constexpr size_t option_count{count(kind_t::option)};
+    //!\brief The number of flags.
+    static constexpr size_t flag_count{count(kind_t::flag)};
+    //!\brief The number of positional options.
+    static constexpr size_t positional_option_count{count(kind_t::positional_option)};
+
+    //!\brief The position of each option among the options, and of each flag among the flags.
+    static constexpr std::array<size_t, descriptor_count> slots = []()
+    {
+        std::array<size_t, descriptor_count> result{};
+        std::array<size_t, 3u> next{};
+
+        for (size_t i = 0; i < descriptor_count; ++i)
+            result[i] = next[static_cast<size_t>(kinds[i])]++;
+
+        return result;
+    }();
+
+    //!\brief Whether `c` may be part of an identifier.
+    static constexpr bool is_valid(char const c)
+    {
+        return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '@' || c == '_'
+            || c == '-';
+    }
+
+    //!\brief Whether each option and flag has an identifier.
+    static constexpr bool ids_are_given()
+    {
+        for (size_t i = 0; i < descriptor_count; ++i)
+            if (kinds[i] != kind_t::positional_option && short_ids[i] == '\0' && long_ids[i].empty())
+                return false;
+
+        return true;
+    }
+
+    //!\brief Whether all identifiers consist of valid characters.
+    static constexpr bool ids_are_valid()
+    {
+        for (size_t i = 0; i < descriptor_count; ++i)
+        {
+            if (short_ids[i] != '\0' && (short_ids[i] == '-' || !is_valid(short_ids[i])))
+                return false;
+
+            if (!long_ids[i].empty()
+                && (long_ids[i].size() == 1u || long_ids[i][0] == '-' || !std::ranges::all_of(long_ids[i], is_valid)))
+                return false;
+        }
+
+        return true;
+    }
+
+    //!\brief Whether no identifier is used twice.
+    static constexpr bool ids_are_unique()
+    {
+        for (size_t i = 0; i < descriptor_count; ++i)
+        {
+            for (size_t j = i + 1u; j < descriptor_count; ++j)
+            {
+                if ((short_ids[i] != '\0' && short_ids[i] == short_ids[j])
+                    || (!long_ids[i].empty() && long_ids[i] == long_ids[j]))
+                    return false;
+            }
+        }
+
+        return true;
+    }
+
+    //!\brief Whether no identifier is one of the special options of a sharg::parser.
+    static constexpr bool ids_are_not_reserved()
+    {
+        constexpr std::array<std::string_view, 6u> reserved{"help",
+                                                            "advanced-help",
+                                                            "hh",
+                                                            "export-help",
+                                                            "version",
+                                                            "copyright"};
+
+        return std::ranges::find(short_ids, 'h') == short_ids.end()
+            && std::ranges::none_of(long_ids,
+                                    [&reserved](std::string_view const id)
+                                    {
+                                        return std::ranges::find(reserved, id) != reserved.end();
+                                    });
+    }
+
+    //!\brief Whether a positional list option is the last positional option.
+    static constexpr bool list_is_last()
+    {
+        constexpr std::array<bool, descriptor_count> is_list{
+            detail::is_container_option<typename descriptor_ts::value_type>...};
+
+        size_t position{};
+        for (size_t i = 0; i < descriptor_count; ++i)
+        {
+            if (kinds[i] == kind_t::positional_option && ++position != positional_option_count && is_list[i])
+                return false;
+        }
+
+        return true;
+    }
+
+    static_assert(ids_are_given(), "Each option and flag of a static_schema needs a short or a long identifier.");
+    static_assert(ids_are_valid(),
+                  "Short identifiers may only contain alphanumeric characters, '_', or '@'. Long identifiers must be "
+                  "longer than one character, may not start with '-' and may only contain alphanumeric characters, "
+                  "'_', '-', or '@'.");
+    static_assert(ids_are_unique(), "The identifiers of the options and flags of a static_schema must be unique.");
+    static_assert(ids_are_not_reserved(),
+                  "The identifiers 'h', 'help', 'advanced-help', 'hh', 'export-help', 'version' and 'copyright' are "
+                  "reserved.");
+    static_assert(list_is_last(), "Only the last positional option of a static_schema may be a list.");
+
+    //!\brief The option or flag of each short identifier; sharg::static_schema::npos if there is none.
+    static constexpr std::array<size_t, 256u> short_lookup = []()
+    {
+        std::array<size_t, 256u> result{};
+        result.fill(npos);
+
+        for (size_t i = 0; i < descriptor_count; ++i)
+            if (short_ids[i] != '\0')
+                result[static_cast<unsigned char>(short_ids[i])] = i;
+
+        return result;
+    }();
+
+    //!\brief The number of long identifiers.
+    static constexpr size_t long_id_count{descriptor_count - static_cast<size_t>(std::ranges::count(long_ids, ""))};
+
+    //!\brief The option or flag of each long identifier.
+    static constexpr auto long_lookup = []()
+    {
+        if constexpr (long_id_count == 0u)
+        {
+            return std::array<std::pair<std::string_view, size_t>, 0u>{};
+        }
+        else
+        {
+            std::pair<std::string_view, size_t> names[long_id_count]{};
+
+            for (size_t i = 0, position = 0; i < descriptor_count; ++i)
+                if (!long_ids[i].empty())
+                    names[position++] = {long_ids[i], i};
+
+            return enumeration_table<size_t, long_id_count>{names};
+        }
+    }();
+
+    //!\brief Refers to the option or flag that an identifier belongs to.
+    struct id_entry
+    {
+        id_kind kind{id_kind::none}; //!< Whether the identifier belongs to an option or a flag.
+        size_t slot{};               //!< The position among the options or among the flags, see slots.
+    };
+
+    //!\brief The entry of each option and flag; the entry at sharg::static_schema::npos is of kind id_kind::none.
+    static constexpr std::array<id_entry, descriptor_count + 1u> id_entries = []()
+    {
+        std::array<id_entry, descriptor_count + 1u> result{};
+
+        for (size_t i = 0; i < descriptor_count; ++i)
+        {
+            if (kinds[i] == kind_t::option)
+                result[i] = id_entry{id_kind::option, slots[i]};
+            else if (kinds[i] == kind_t::flag)
+                result[i] = id_entry{id_kind::flag, slots[i]};
+        }
+
+        return result;
+    }();
+
+    //!\brief Returns the option or flag of a short identifier; an entry of kind id_kind::none if there is none.
+    static id_entry find_id(char const id) noexcept
+    {
+        return id_entries[short_lookup[static_cast<unsigned char>(id)]];
+    }
+
+    //!\brief Returns the option or flag of a long identifier; an entry of kind id_kind::none if there is none.
+    static id_entry find_id(std::string_view const id) noexcept
+    {
+        if constexpr (long_id_count == 0u)
+        {
+            return id_entries[npos];
+        }
+        else
+        {
+            auto it = long_lookup.find(id);
+            return id_entries[(it == long_lookup.end()) ? npos : it->second];
+        }
+    }
+
+    //!\brief A value recorded for the option at `slot`, see sharg::static_schema::slots.
+    struct recorded_occurrence
+    {
+        size_t slot;                   //!< The position of the option among the options.
+        option_occurrence occurrence;  //!< The value.
+    };
+
+    //!\brief The state of a single parse.
+    struct parse_state
+    {
+        //!\brief The values given for the options, in command line order.
+        std::vector<recorded_occurrence> recorded{};
+        //!\brief The values given for the options, grouped by option and in command line order.
+        std::vector<option_occurrence> occurrences{};
+        //!\brief The values of option `i` are `occurrences[offsets[i]]` to `occurrences[offsets[i + 1] - 1]`.
+        std::array<size_t, option_count + 1u> offsets{};
+        //!\brief Whether each flag was given.
+        std::array<bool, flag_count> flags{};
+        //!\brief The first identifier given on the command line that is not known.
+        std::string unknown_id{};
+        //!\brief The positional arguments and the progress of retrieving them.
+        positional_state positionals{};
+    };
+
+    //!\brief Looks up the identifiers in the tables computed at compile time and records the options and flags.
+    struct tokenize_handler
+    {
+        parse_state & state; //!< The state of the parse.
+
+        //!\copydoc static_schema::find_id(char const)
+        static id_entry find_id(char const id) noexcept
+        {
+            return static_schema::find_id(id);
+        }
+
+        //!\copydoc static_schema::find_id(std::string_view const)
+        static id_entry find_id(std::string_view const id) noexcept
+        {
+            return static_schema::find_id(id);
+        }
+
+        //!\brief Records the value of the option of `entry`.
+        void record_option(id_entry const entry,
+                           std::span<std::string_view const>::iterator,
+                           option_occurrence const occurrence)
+        {
+            state.recorded.push_back(recorded_occurrence{entry.slot, occurrence});
+        }
+
+        //!\brief Records the flag of `entry`; `false` if it was already given.
+        bool record_flag(id_entry const entry, std::span<std::string_view const>::iterator)
+        {
+            if (state.flags[entry.slot])
+                return false;
+
+            state.flags[entry.slot] = true;
+            return true;
+        }
+    };
+
+    //!\brief The options, flags and positional options.
+    std::tuple<descriptor_ts...> descriptors;
+
+    //!\brief Verifies the configuration of a descriptor, see sharg::detail::config_verifier.
+    template <typename descriptor_t>
+    static void verify(detail::config_verifier & verifier, descriptor_t const & descriptor)
+    {
+        if constexpr (descriptor_t::kind == kind_t::option)
+        {
+            verifier.verify_option_config(descriptor.configuration,
+                                          detail::is_container_option<typename descriptor_t::value_type>);
+        }
+        else if constexpr (descriptor_t::kind == kind_t::flag)
+        {
+            verifier.verify_flag_config(descriptor.configuration);
+
+            if (options_type{}.*descriptor.member)
+                throw design_error("A flag's default value must be false.");
+        }
+        else
+        {
+            verifier.verify_positional_option_config(descriptor.configuration,
+                                                     detail::is_container_option<typename descriptor_t::value_type>,
+                                                     false);
+        }
+    }
+
+    //!\brief Groups the recorded values by option, keeping the command line order (counting sort).
+    static void group_occurrences(parse_state & state)
+    {
+        if constexpr (option_count != 0u)
+        {
+            for (recorded_occurrence const & recorded : state.recorded)
+                ++state.offsets[recorded.slot + 1u];
+
+            for (size_t i = 1u; i <= option_count; ++i)
+                state.offsets[i] += state.offsets[i - 1u];
+
+            std::array<size_t, option_count> next{};
+            std::ranges::copy_n(state.offsets.begin(), option_count, next.begin());
+
+            state.occurrences.resize(state.recorded.size());
+            for (recorded_occurrence const & recorded : state.recorded)
+                state.occurrences[next[recorded.slot]++] = recorded.occurrence;
+        }
+    }
+
+    //!\brief Retrieves the value of the option at `index`, if it is an option.
+    template <size_t index>
+    void get_option(options_type & result, parse_state const & state) const
+    {
+        if constexpr (kinds[index] == kind_t::option)
+        {
+            auto const & descriptor = std::get<index>(descriptors);
+            std::span<option_occurrence const> const occurrences{state.occurrences.data() + state.offsets[slots[index]],
+                                                                 state.occurrences.data()
+                                                                     + state.offsets[slots[index] + 1u]};
+            value_parser::get_option(result.*descriptor.member, descriptor.configuration, occurrences);
+        }
+    }
+
+    //!\brief Retrieves the value of the flag at `index`, if it is a flag.
+    template <size_t index>
+    void get_flag(options_type & result, parse_state const & state) const
+    {
+        if constexpr (kinds[index] == kind_t::flag)
+            result.*std::get<index>(descriptors).member = state.flags[slots[index]];
+    }
+
+    //!\brief Retrieves the value of the positional option at `index`, if it is a positional option.
+    template <size_t index>
+    void get_positional_option(options_type & result, parse_state & state) const
+    {
+        if constexpr (kinds[index] == kind_t::positional_option)
+        {
+            auto const & descriptor = std::get<index>(descriptors);
+            value_parser::get_positional_option(result.*descriptor.member,
+                                                descriptor.configuration,
+                                                state.positionals,
+                                                positional_option_count);
+        }
+    }
+};
+
+//!\brief Deduces the options from the arguments.
+template <typename... descriptor_ts>
+static_schema(descriptor_ts...) -> static_schema<descriptor_ts...>;
+
+} // namespace sharg
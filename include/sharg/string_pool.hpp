@@ -0,0 +1,304 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \author Enrico Seiler <enrico.seiler AT fu-berlin.de>
+ * \brief Provides sharg::string_pool.
+ */
+
+#pragma once
+
+#include <cassert>
+#include <compare>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <sharg/platform.hpp>
+
+namespace sharg
+{
+
+/*!\brief A compact container of strings for options that take many values, e.g. a list of files.
+ * \ingroup parser
+ *
+ * \details
+ *
+ * All characters are stored in a single buffer and the elements are accessed as std::string_view. In contrast to
+ * `std::vector<std::string>`, adding a string does not allocate memory of its own and each element needs 8 bytes in
+ * addition to its characters instead of 32.
+ *
+ * The sharg::string_pool can be used like `std::vector<std::string>` for options and positional options, including
+ * sharg::config::list_delimiter and the validators for strings and files. The help page shows it as a list of
+ * std::string_view. In contrast to `std::vector<std::string_view>`, which is not a valid option type, the pool stores
+ * copies of the arguments and hence remains valid after the parser is destroyed.
+ *
+ * \include test/snippet/string_pool.cpp
+ *
+ * The views returned by the element access functions are invalidated by any function that adds elements.
+ *
+ * \remark For a complete overview, take a look at \ref parser
+ *
+ * \details
+ * \experimentalapi{Experimental since version 1.2.3.}
+ */
+class string_pool
+{
+public:
+    class iterator;
+
+    /*!\name Member types
+     * \{
+     */
+    using value_type = std::string_view;      //!< The type of the elements.
+    using reference = std::string_view;       //!< The elements are returned by value.
+    using const_reference = std::string_view; //!< The elements are returned by value.
+    using const_iterator = iterator;          //!< The elements cannot be modified.
+    using size_type = size_t;                 //!< The type of sizes and indices.
+    using difference_type = ptrdiff_t;        //!< The type of the difference of two iterators.
+    //!\}
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    string_pool() = default;                                //!< Defaulted.
+    string_pool(string_pool const &) = default;             //!< Defaulted.
+    string_pool(string_pool &&) = default;                  //!< Defaulted.
+    string_pool & operator=(string_pool const &) = default; //!< Defaulted.
+    string_pool & operator=(string_pool &&) = default;      //!< Defaulted.
+    ~string_pool() = default;                               //!< Defaulted.
+
+    //!\brief Constructs the pool from a list of strings, e.g. the default value `{"a.fa", "b.fa"}`.
+    string_pool(std::initializer_list<std::string_view> const strings)
+    {
+        for (std::string_view const string : strings)
+            push_back(string);
+    }
+    //!\}
+
+    /*!\name Element access
+     * \{
+     */
+    //!\brief Returns the element at position `index`.
+    std::string_view operator[](size_type const index) const noexcept
+    {
+        assert(index < size());
+        size_t const begin = index == 0u ? 0u : ends[index - 1u];
+        return {characters.data() + begin, ends[index] - begin};
+    }
+
+    //!\brief Returns the first element.
+    std::string_view front() const noexcept
+    {
+        return (*this)[0u];
+    }
+
+    //!\brief Returns the last element.
+    std::string_view back() const noexcept
+    {
+        return (*this)[size() - 1u];
+    }
+    //!\}
+
+    /*!\name Iterators
+     * \{
+     */
+    //!\brief Returns an iterator to the first element.
+    iterator begin() const noexcept;
+
+    //!\brief Returns an iterator behind the last element.
+    iterator end() const noexcept;
+    //!\}
+
+    /*!\name Capacity
+     * \{
+     */
+    //!\brief Returns the number of elements.
+    size_type size() const noexcept
+    {
+        return ends.size();
+    }
+
+    //!\brief Whether the pool has no elements.
+    bool empty() const noexcept
+    {
+        return ends.empty();
+    }
+
+    //!\brief Returns the number of characters of all elements.
+    size_type character_count() const noexcept
+    {
+        return characters.size();
+    }
+
+    //!\brief Reserves memory for `count` elements; the characters are reserved with reserve_characters().
+    void reserve(size_type const count)
+    {
+        ends.reserve(count);
+    }
+
+    //!\brief Reserves memory for `count` characters of all elements.
+    void reserve_characters(size_type const count)
+    {
+        characters.reserve(count);
+    }
+    //!\}
+
+    /*!\name Modifiers
+     * \{
+     */
+    //!\brief Appends a copy of `string`.
+    void push_back(std::string_view const string)
+    {
+        characters.append(string);
+        ends.push_back(characters.size());
+    }
+
+    //!\brief Removes all elements; the memory is kept.
+    void clear() noexcept
+    {
+        characters.clear();
+        ends.clear();
+    }
+    //!\}
+
+    //!\brief Compares the elements.
+    bool operator==(string_pool const &) const = default;
+
+private:
+    std::string characters{};  //!< The characters of all elements.
+    std::vector<size_t> ends{}; //!< The position behind the last character of each element.
+};
+
+/*!\brief A random access iterator over the elements of a sharg::string_pool.
+ * \details
+ * \experimentalapi{Experimental since version 1.2.3.}
+ */
+class string_pool::iterator
+{
+public:
+    /*!\name Member types
+     * \{
+     */
+    using iterator_concept = std::random_access_iterator_tag; //!< The C++20 iterator category.
+    using iterator_category = std::input_iterator_tag;        //!< The elements are returned by value.
+    using value_type = std::string_view;                      //!< The type of the elements.
+    using reference = std::string_view;                       //!< The elements are returned by value.
+    using difference_type = ptrdiff_t;                        //!< The type of the difference of two iterators.
+    //!\}
+
+    //!\brief Defaulted.
+    iterator() = default;
+
+    //!\brief Constructs an iterator pointing to the element at `position` in `host`.
+    iterator(string_pool const & host, size_t const position) noexcept : pool{&host}, index{position}
+    {}
+
+    //!\brief Returns the element.
+    std::string_view operator*() const noexcept
+    {
+        return (*pool)[index];
+    }
+
+    //!\brief Returns the element `offset` positions ahead.
+    std::string_view operator[](difference_type const offset) const noexcept
+    {
+        return (*pool)[index + offset];
+    }
+
+    /*!\name Arithmetic operators
+     * \{
+     */
+    iterator & operator++() noexcept //!< Advances by one element.
+    {
+        ++index;
+        return *this;
+    }
+
+    iterator operator++(int) noexcept //!< Advances by one element.
+    {
+        iterator previous{*this};
+        ++index;
+        return previous;
+    }
+
+    iterator & operator--() noexcept //!< Goes back by one element.
+    {
+        --index;
+        return *this;
+    }
+
+    iterator operator--(int) noexcept //!< Goes back by one element.
+    {
+        iterator previous{*this};
+        --index;
+        return previous;
+    }
+
+    iterator & operator+=(difference_type const offset) noexcept //!< Advances by `offset` elements.
+    {
+        index += offset;
+        return *this;
+    }
+
+    iterator & operator-=(difference_type const offset) noexcept //!< Goes back by `offset` elements.
+    {
+        index -= offset;
+        return *this;
+    }
+
+    friend iterator operator+(iterator it, difference_type const offset) noexcept //!< Advances by `offset`.
+    {
+        return it += offset;
+    }
+
+    friend iterator operator+(difference_type const offset, iterator it) noexcept //!< Advances by `offset`.
+    {
+        return it += offset;
+    }
+
+    friend iterator operator-(iterator it, difference_type const offset) noexcept //!< Goes back by `offset`.
+    {
+        return it -= offset;
+    }
+
+    friend difference_type operator-(iterator const & lhs, iterator const & rhs) noexcept //!< The distance.
+    {
+        return static_cast<difference_type>(lhs.index) - static_cast<difference_type>(rhs.index);
+    }
+    //!\}
+
+    /*!\name Comparison operators
+     * \{
+     */
+    friend bool operator==(iterator const & lhs, iterator const & rhs) noexcept //!< Compares the positions.
+    {
+        return lhs.index == rhs.index;
+    }
+
+    friend std::strong_ordering operator<=>(iterator const & lhs, iterator const & rhs) noexcept //!< \copybrief ==
+    {
+        return lhs.index <=> rhs.index;
+    }
+    //!\}
+
+private:
+    string_pool const * pool{}; //!< The pool.
+    size_t index{};             //!< The position of the element in the pool.
+};
+
+inline string_pool::iterator string_pool::begin() const noexcept
+{
+    return {*this, 0u};
+}
+
+inline string_pool::iterator string_pool::end() const noexcept
+{
+    return {*this, size()};
+}
+
+} // namespace sharg
@@ -14,9 +14,13 @@
 #include <concepts>
 #include <exception>
 #include <fstream>
+#include <memory>
+#include <optional>
 #include <ranges>
 #include <regex>
 
+#include <sharg/detail/compiled_regex.hpp>
+#include <sharg/detail/path_status.hpp>
 #include <sharg/detail/safe_filesystem_entry.hpp>
 #include <sharg/detail/to_string.hpp>
 #include <sharg/exceptions.hpp>
@@ -227,12 +231,13 @@ public:
      */
     void operator()(option_value_type const & cmp) const
     {
-        if (!(std::find(values.begin(), values.end(), cmp) != values.end()))
-            throw validation_error{detail::to_string("Value ", cmp, " is not one of ", values, ".")};
+        validate(cmp);
     }
 
     /*!\brief Tests whether every element in \p range lies inside values.
-     * \tparam range_type The type of range to check; must model std::ranges::forward_range.
+     * \tparam range_type The type of range to check; must model std::ranges::forward_range and its elements must be
+     *                    convertible to or comparable with the option value type, e.g. the std::string_view
+     *                    elements of a sharg::string_pool.
      * \param  range      The input range to iterate over and check every element.
      * \throws sharg::validation_error
      *
@@ -240,7 +245,8 @@ public:
      * \stableapi{Since version 1.0.}
      */
     template <std::ranges::forward_range range_type>
-        requires std::convertible_to<std::ranges::range_value_t<range_type>, option_value_type>
+        requires (std::convertible_to<std::ranges::range_value_t<range_type>, option_value_type>
+                  || std::equality_comparable_with<std::ranges::range_value_t<range_type>, option_value_type>)
               && (!std::same_as<std::remove_cvref_t<range_type>, std::filesystem::path>)
     void operator()(range_type const & range) const
     {
@@ -248,7 +254,10 @@ public:
                       std::ranges::end(range),
                       [&](auto && cmp)
                       {
-                          (*this)(cmp);
+                          if constexpr (std::convertible_to<decltype(cmp), option_value_type>)
+                              (*this)(cmp);
+                          else
+                              validate(cmp);
                       });
     }
 
@@ -265,6 +274,14 @@ public:
 private:
     //!\brief Minimum of the range to test.
     std::vector<option_value_type> values{};
+
+    //!\brief Throws a sharg::validation_error if `cmp` is not one of the values.
+    template <typename value_t>
+    void validate(value_t const & cmp) const
+    {
+        if (std::find(values.begin(), values.end(), cmp) == values.end())
+            throw validation_error{detail::to_string("Value ", cmp, " is not one of ", values, ".")};
+    }
 };
 
 /*!\name Type deduction guides
@@ -405,11 +422,36 @@ protected:
 
     /*!\brief Checks if the given path is readable.
      * \param path The path to check.
+     * \param type The type of the path as determined by sharg::detail::fast_path_type, if available.
      * \throws sharg::validation_error if the path is not readable, or
      *         std::filesystem::filesystem_error on underlying OS API errors.
+     *
+     * \details
+     * If the type of the path is known, the permission is checked with sharg::detail::fast_path_access instead of
+     * opening the file or directory.
      */
-    void validate_readability(std::filesystem::path const & path) const
+    void validate_readability(std::filesystem::path const & path,
+                              std::optional<detail::path_type> const type = std::nullopt) const
     {
+        if (type)
+        {
+            if (*type == detail::path_type::directory)
+            {
+                if (!detail::fast_path_access(path, detail::path_access::read))
+                    throw validation_error{"Cannot read the directory \"" + path.string() + "\"!"};
+            }
+            else if (*type != detail::path_type::regular_file)
+            {
+                throw validation_error{"Expected a regular file \"" + path.string() + "\"!"};
+            }
+            else if (!detail::fast_path_access(path, detail::path_access::read))
+            {
+                throw validation_error{"Cannot read the file \"" + path.string() + "\"!"};
+            }
+
+            return;
+        }
+
         // Check if input directory is readable.
         if (std::filesystem::is_directory(path))
         {
@@ -433,12 +475,32 @@ protected:
 
     /*!\brief Checks if the given path is writable.
      * \param path The path to check.
+     * \param type The type of the path as determined by sharg::detail::fast_path_type, if available.
      * \throws sharg::validation_error if the given path is a directory.
      * \throws sharg::validation_error if the file could not be opened for writing.
      * \throws std::filesystem::filesystem_error on underlying OS API errors.
+     *
+     * \details
+     * If the type of the path is known, no file is created. Instead, sharg::detail::fast_path_access checks whether
+     * an existing file is writable, or whether the file can be created in its parent directory.
      */
-    void validate_writeability(std::filesystem::path const & path) const
+    void validate_writeability(std::filesystem::path const & path,
+                               std::optional<detail::path_type> const type = std::nullopt) const
     {
+        if (type && *type != detail::path_type::directory)
+        {
+            bool const writable =
+                (*type == detail::path_type::not_found)
+                    ? path.has_filename()
+                          && detail::fast_path_access(parent_directory(path), detail::path_access::create)
+                    : detail::fast_path_access(path, detail::path_access::write);
+
+            if (!writable)
+                throw validation_error{"Cannot write \"" + path.string() + "\"!"};
+
+            return;
+        }
+
         // Contingency check. This case should already be handled by the output_file_validator.
         // Opening a file handle on a directory would delete its contents.
         // LCOV_EXCL_START
@@ -446,6 +508,17 @@ protected:
             throw validation_error{"\"" + path.string() + "\" is a directory. Cannot validate writeability."};
         // LCOV_EXCL_STOP
 
+        // An existing file is neither truncated nor removed.
+        if (std::filesystem::exists(path))
+        {
+            std::ofstream file{path, std::ios::app};
+
+            if (!file.is_open() || !file.good())
+                throw validation_error{"Cannot write \"" + path.string() + "\"!"};
+
+            return;
+        }
+
         std::ofstream file{path};
         sharg::detail::safe_filesystem_entry file_guard{path};
 
@@ -459,6 +532,13 @@ protected:
         file_guard.remove();
     }
 
+    //!\brief Returns the directory that contains `path`, ignoring a trailing separator; `.` if there is none.
+    static std::filesystem::path parent_directory(std::filesystem::path const & path)
+    {
+        std::filesystem::path parent = (path.has_filename() ? path : path.parent_path()).parent_path();
+        return parent.empty() ? std::filesystem::path{"."} : parent;
+    }
+
     //!\brief Returns the information of valid file extensions.
     std::string valid_extensions_help_page_message() const
     {
@@ -565,11 +645,14 @@ public:
     {
         try
         {
-            if (!std::filesystem::exists(file))
+            // A single statx on Linux; std::filesystem is used if it is not available.
+            std::optional<detail::path_type> const type = detail::fast_path_type(file);
+
+            if (type ? *type == detail::path_type::not_found : !std::filesystem::exists(file))
                 throw validation_error{"The file \"" + file.string() + "\" does not exist!"};
 
             // Check if file is regular and can be opened for reading.
-            validate_readability(file);
+            validate_readability(file, type);
 
             // Check extension.
             validate_filename(file);
@@ -721,16 +804,20 @@ public:
      */
     virtual void operator()(std::filesystem::path const & file) const override
     {
-        if (std::filesystem::is_directory(file))
+        // A single statx on Linux; std::filesystem is used if it is not available.
+        std::optional<detail::path_type> const type = detail::fast_path_type(file);
+
+        if (type ? *type == detail::path_type::directory : std::filesystem::is_directory(file))
             throw validation_error{"\"" + file.string() + "\" is a directory. Expected a file."};
 
         try
         {
-            if ((open_mode == output_file_open_options::create_new) && std::filesystem::exists(file))
+            if ((open_mode == output_file_open_options::create_new)
+                && (type ? *type != detail::path_type::not_found : std::filesystem::exists(file)))
                 throw validation_error{"The file \"" + file.string() + "\" already exists!"};
 
             // Check if file has any write permissions.
-            validate_writeability(file);
+            validate_writeability(file, type);
 
             validate_filename(file);
         }
@@ -825,14 +912,17 @@ public:
     {
         try
         {
-            if (!std::filesystem::exists(dir))
+            // A single statx on Linux; std::filesystem is used if it is not available.
+            std::optional<detail::path_type> const type = detail::fast_path_type(dir);
+
+            if (type ? *type == detail::path_type::not_found : !std::filesystem::exists(dir))
                 throw validation_error{"The directory \"" + dir.string() + "\" does not exists!"};
 
-            if (!std::filesystem::is_directory(dir))
+            if (type ? *type != detail::path_type::directory : !std::filesystem::is_directory(dir))
                 throw validation_error{"The path \"" + dir.string() + "\" is not a directory!"};
 
             // Check if directory has any read permissions.
-            validate_readability(dir);
+            validate_readability(dir, type);
         }
         // LCOV_EXCL_START
         catch (std::filesystem::filesystem_error & ex)
@@ -908,6 +998,23 @@ public:
      */
     virtual void operator()(std::filesystem::path const & dir) const override
     {
+        // Without creating a directory or a file: A single statx and faccessat on Linux.
+        if (std::optional<detail::path_type> const type = detail::fast_path_type(dir))
+        {
+            if (*type == detail::path_type::directory)
+            {
+                if (!detail::fast_path_access(dir, detail::path_access::create))
+                    throw validation_error{"Cannot write \"" + (dir / "dummy.txt").string() + "\"!"};
+            }
+            else if (*type != detail::path_type::not_found
+                     || !detail::fast_path_access(parent_directory(dir), detail::path_access::create))
+            {
+                throw validation_error{"Cannot create directory: \"" + dir.string() + "\"!"};
+            }
+
+            return;
+        }
+
         bool dir_exists = std::filesystem::exists(dir);
         // Make sure the created dir is deleted after we are done.
         std::error_code ec;
@@ -964,6 +1071,11 @@ public:
  * Note: A regex_match will only return true if the strings matches the pattern
  * completely (in contrast to regex_search which also matches substrings).
  *
+ * The pattern is compiled once on construction and shared between copies of the validator.
+ * Patterns that only consist of (anchored) quantified character classes, e.g. `^chr[0-9XYM]+$` or
+ * `[a-zA-Z0-9_.-]{1,32}`, are matched by a lightweight automaton instead of std::regex.
+ * An invalid pattern is reported when validating, not on construction.
+ *
  * The class than acts as a functor, that throws a sharg::validation_error
  * exception whenever string does not match the pattern.
  *
@@ -985,7 +1097,9 @@ public:
      * \details
      * \stableapi{Since version 1.0.}
      */
-    regex_validator(std::string const & pattern_) : pattern{pattern_}
+    regex_validator(std::string const & pattern_) :
+        pattern{pattern_},
+        compiled_pattern{std::make_shared<detail::compiled_regex const>(pattern)}
     {}
 
     /*!\brief Tests whether cmp lies inside values.
@@ -997,14 +1111,13 @@ public:
      */
     void operator()(option_value_type const & cmp) const
     {
-        std::regex rgx(pattern);
-        if (!std::regex_match(cmp, rgx))
-            throw validation_error{"Value " + cmp + " did not match the pattern " + pattern + "."};
+        std::smatch match{};
+        validate(cmp, match);
     }
 
     /*!\brief Tests whether every entry in list v matches the pattern.
      * \tparam range_type The type of range to check; must model std::ranges::forward_range and the value type must
-     *                    be convertible to std::string.
+     *                    be convertible to std::string or be std::string_view, e.g. for a sharg::string_pool.
      * \param  v          The input range to iterate over and check every element.
      * \throws sharg::validation_error
      *
@@ -1013,12 +1126,24 @@ public:
      */
     template <std::ranges::forward_range range_type>
         requires std::convertible_to<std::ranges::range_reference_t<range_type>, std::string const &>
+              || std::same_as<std::ranges::range_reference_t<range_type>, std::string_view>
     void operator()(range_type const & v) const
     {
+        std::smatch match{};  // Reused for all entries.
+        std::string buffer{}; // Reused for the entries of a sharg::string_pool.
+
         for (auto && entry : v)
         {
-            // note: we explicitly copy/construct any reference type other than `std::string &`
-            (*this)(static_cast<std::string const &>(entry));
+            if constexpr (std::same_as<std::ranges::range_reference_t<range_type>, std::string_view>)
+            {
+                buffer.assign(entry);
+                validate(buffer, match);
+            }
+            else
+            {
+                // note: we explicitly copy/construct any reference type other than `std::string &`
+                validate(static_cast<std::string const &>(entry), match);
+            }
         }
     }
 
@@ -1035,6 +1160,16 @@ public:
 private:
     //!\brief The pattern to match.
     std::string pattern;
+
+    //!\brief The compiled pattern, shared between copies.
+    std::shared_ptr<detail::compiled_regex const> compiled_pattern;
+
+    //!\brief Throws a sharg::validation_error if `cmp` does not match the pattern.
+    void validate(std::string const & cmp, std::smatch & match) const
+    {
+        if (!compiled_pattern->matches(cmp, match))
+            throw validation_error{"Value " + cmp + " did not match the pattern " + pattern + "."};
+    }
 };
 
 namespace detail
@@ -15,9 +15,9 @@ function (collect_used_test target)
          CACHE STRING "" FORCE)
 endfunction ()
 
-# Glob all test files (e.g. *.cpp files) and compare them to the list of used test targets.
+# Glob all test files (i.e. *_test.cpp files) and compare them to the list of used test targets.
 function (list_unused_unit_tests)
-    file (GLOB_RECURSE test_source_glob_list *.cpp)
+    file (GLOB_RECURSE test_source_glob_list *_test.cpp)
     set (test_source_declared_list "")
 
     # get the source location of each "used" test target and collect it.
@@ -0,0 +1,183 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*!\file
+ * \author Enrico Seiler <enrico.seiler AT fu-berlin.de>
+ * \brief Provides sharg::test::http_server.
+ */
+
+#pragma once
+
+#include <netinet/in.h>
+#include <poll.h>
+#include <unistd.h>
+
+#include <sys/socket.h>
+
+#include <atomic>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#include <sharg/platform.hpp>
+
+namespace sharg::test
+{
+
+/*!\brief A local stand-in for the version check server.
+ *
+ * Listens on a random port of the loopback interface and answers every request with `200 OK` and a fixed body,
+ * such that the version check can be tested and benchmarked offline.
+ *
+ * ### Example
+ *
+ * ```cpp
+ * sharg::test::http_server server{"1.0.0\n1.0.0\n"};
+ * checker.server_url = server.url();
+ * ```
+ */
+class http_server
+{
+public:
+    /*!\brief Starts the server.
+     * \param[in] body The body of every response.
+     * \throws std::runtime_error if no socket could be opened.
+     */
+    explicit http_server(std::string body) : body{std::move(body)}
+    {
+        socket_fd = ::socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+
+        sockaddr_in address{};
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        socklen_t length = sizeof(address);
+
+        if (socket_fd < 0 || ::bind(socket_fd, reinterpret_cast<sockaddr *>(&address), length) != 0
+            || ::listen(socket_fd, 16) != 0
+            || ::getsockname(socket_fd, reinterpret_cast<sockaddr *>(&address), &length) != 0)
+        {
+            close_socket();
+            throw std::runtime_error{"Could not start the local HTTP server."};
+        }
+
+        port = ntohs(address.sin_port);
+        thread = std::jthread{[this](std::stop_token stop)
+                              {
+                                  serve(stop);
+                              }};
+    }
+
+    http_server(http_server const &) = delete;             //!< Deleted.
+    http_server & operator=(http_server const &) = delete; //!< Deleted.
+
+    //!\brief Stops the server.
+    ~http_server()
+    {
+        thread.request_stop();
+
+        if (thread.joinable())
+            thread.join();
+
+        close_socket();
+    }
+
+    //!\brief Returns the URL of the server, e.g. `http://127.0.0.1:12345/`.
+    std::string url() const
+    {
+        return "http://127.0.0.1:" + std::to_string(port) + "/";
+    }
+
+    //!\brief Returns the number of answered requests.
+    size_t request_count() const
+    {
+        return requests.load();
+    }
+
+    //!\brief Returns the path of the last request, e.g. `/SeqAn-Sharg_Linux_64_app_1.0.0`.
+    std::string last_path() const
+    {
+        std::lock_guard lock{mutex};
+        return path;
+    }
+
+private:
+    std::string body{};              //!< The body of every response.
+    int socket_fd{-1};               //!< The listening socket.
+    uint16_t port{};                 //!< The port of the listening socket.
+    std::atomic<size_t> requests{};  //!< The number of answered requests.
+    mutable std::mutex mutex{};      //!< Guards path.
+    std::string path{};              //!< The path of the last request.
+    std::jthread thread{};           //!< Accepts and answers connections.
+
+    //!\brief Closes the listening socket.
+    void close_socket()
+    {
+        if (socket_fd >= 0)
+            ::close(socket_fd);
+
+        socket_fd = -1;
+    }
+
+    //!\brief Answers connections one by one until a stop is requested.
+    void serve(std::stop_token const & stop)
+    {
+        while (!stop.stop_requested())
+        {
+            pollfd listening{.fd = socket_fd, .events = POLLIN, .revents = 0};
+
+            if (::poll(&listening, 1, 20) <= 0)
+                continue;
+
+            int const connection = ::accept4(socket_fd, nullptr, nullptr, SOCK_CLOEXEC);
+
+            if (connection < 0)
+                continue;
+
+            answer(connection);
+            ::close(connection);
+        }
+    }
+
+    //!\brief Reads the request header and sends the response.
+    void answer(int const connection)
+    {
+        std::string request{};
+        char buffer[1024];
+
+        while (request.find("\r\n\r\n") == std::string::npos)
+        {
+            ssize_t const count = ::recv(connection, buffer, sizeof(buffer), 0);
+
+            if (count <= 0)
+                return;
+
+            request.append(buffer, count);
+        }
+
+        // The request line is "GET <path> HTTP/1.1".
+        size_t const path_begin = request.find(' ') + 1u;
+        {
+            std::lock_guard lock{mutex};
+            path = request.substr(path_begin, request.find(' ', path_begin) - path_begin);
+        }
+
+        std::string const response = "HTTP/1.1 200 OK\r\nContent-Type: text/plain\r\nContent-Length: "
+                                   + std::to_string(body.size()) + "\r\nConnection: close\r\n\r\n" + body;
+
+        for (size_t sent = 0; sent < response.size();)
+        {
+            ssize_t const count = ::send(connection, response.data() + sent, response.size() - sent, MSG_NOSIGNAL);
+
+            if (count <= 0)
+                return;
+
+            sent += count;
+        }
+
+        ++requests;
+    }
+};
+
+} // namespace sharg::test
@@ -34,10 +34,17 @@ struct test_accessor
         return parser.executable_name;
     }
 
+    static std::span<std::string_view const> arguments(sharg::parser & parser)
+    {
+        return parser.arguments;
+    }
+
+#if !SHARG_DISABLE_VERSION_CHECK
     static auto & version_check_future(sharg::parser & parser)
     {
         return parser.version_check_future;
     }
+#endif
 };
 
 } // namespace sharg::detail
@@ -0,0 +1,134 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <benchmark/benchmark.h>
+
+#include <deque>
+
+#include <sharg/parser.hpp>
+
+// A stream buffer that discards its input and counts the characters.
+class counting_streambuf : public std::streambuf
+{
+public:
+    size_t count{};
+
+protected:
+    int_type overflow(int_type const c) override
+    {
+        ++count;
+        return traits_type::not_eof(c);
+    }
+
+    std::streamsize xsputn(char const *, std::streamsize const n) override
+    {
+        count += n;
+        return n;
+    }
+};
+
+// The options of the exported help page, e.g. `--option-1 <int>`.
+struct help_page_options
+{
+    explicit help_page_options(size_t const option_count) :
+        int_values(option_count),
+        flag_values(option_count),
+        option_configs(option_count),
+        flag_configs(option_count)
+    {
+        for (size_t i = 0; i < option_count; ++i)
+        {
+            option_configs[i] = sharg::config{.long_id = "option-" + std::to_string(i),
+                                              .description = "The option number " + std::to_string(i) + "."};
+            flag_configs[i] = sharg::config{.long_id = "flag-" + std::to_string(i),
+                                            .description = "The flag number " + std::to_string(i) + "."};
+        }
+
+        meta.app_name = "benchmark";
+        meta.version = "1.0.0";
+        meta.short_description = "Benchmarks the export of help pages.";
+        meta.description.push_back("Exports a help page with many options.");
+    }
+
+    // Adds the options, a section and a positional option to the given format.
+    template <typename format_t>
+    void add_to(format_t & format)
+    {
+        format.add_section("Options", false);
+
+        for (size_t i = 0; i < option_configs.size(); ++i)
+        {
+            flag_values[i] = false;
+            format.add_option(int_values[i], option_configs[i]);
+            format.add_flag(flag_values[i], flag_configs[i]);
+        }
+
+        format.add_positional_option(positional_value, positional_config);
+    }
+
+    std::vector<int> int_values;
+    std::deque<bool> flag_values;
+    std::vector<sharg::config<>> option_configs;
+    std::vector<sharg::config<>> flag_configs;
+    std::string positional_value{};
+    sharg::config<> positional_config{.description = "The positional option."};
+    sharg::parser_meta_data meta{};
+    std::vector<std::string> const executable_name{"benchmark"};
+};
+
+// Exports the help page of `option_count` options and `option_count` flags in the format constructed by `make_format`.
+template <typename make_format_t>
+void export_help(benchmark::State & state, make_format_t make_format)
+{
+    help_page_options options{static_cast<size_t>(state.range(0))};
+
+    counting_streambuf output{};
+    std::streambuf * const cout_buffer = std::cout.rdbuf(&output);
+
+    for (auto _ : state)
+    {
+        auto format = make_format();
+        options.add_to(format);
+        format.parse(options.meta, options.executable_name);
+    }
+
+    std::cout.rdbuf(cout_buffer);
+    state.SetBytesProcessed(output.count);
+}
+
+BENCHMARK_CAPTURE(export_help,
+                  man,
+                  []
+                  {
+                      return sharg::detail::format_man{{}, sharg::update_notifications::off};
+                  })
+    ->RangeMultiplier(10)
+    ->Range(10, 1'000);
+BENCHMARK_CAPTURE(export_help,
+                  html,
+                  []
+                  {
+                      return sharg::detail::format_html{{}, sharg::update_notifications::off};
+                  })
+    ->RangeMultiplier(10)
+    ->Range(10, 1'000);
+
+#if SHARG_HAS_TDL
+BENCHMARK_CAPTURE(export_help,
+                  cwl,
+                  []
+                  {
+                      return sharg::detail::format_tdl{sharg::detail::format_tdl::FileFormat::CWL};
+                  })
+    ->RangeMultiplier(10)
+    ->Range(10, 1'000);
+BENCHMARK_CAPTURE(export_help,
+                  ctd,
+                  []
+                  {
+                      return sharg::detail::format_tdl{sharg::detail::format_tdl::FileFormat::CTD};
+                  })
+    ->RangeMultiplier(10)
+    ->Range(10, 1'000);
+#endif
@@ -0,0 +1,61 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <benchmark/benchmark.h>
+
+#include <sharg/detail/version_check.hpp>
+#include <sharg/test/http_server.hpp>
+#include <sharg/test/tmp_filename.hpp>
+
+// The version check writes its files into $HOME/.config/seqan.
+sharg::test::tmp_filename const home{"home"};
+sharg::test::http_server const server{"1.0.0\n1.0.0\n"};
+
+sharg::detail::version_checker make_checker()
+{
+    setenv(sharg::detail::version_checker::home_env_name, home.get_path().parent_path().c_str(), 1);
+
+    sharg::detail::version_checker checker{"benchmark_app", "1.0.0"};
+    checker.server_url = server.url();
+    return checker;
+}
+
+// The time the version check takes on the calling thread, i.e. until the download program was started.
+void version_check_start(benchmark::State & state)
+{
+    sharg::detail::version_checker checker = make_checker();
+
+    for (auto _ : state)
+    {
+        std::promise<bool> prom{};
+        std::future<bool> future = prom.get_future();
+        checker(std::move(prom));
+
+        state.PauseTiming();
+        future.wait();
+        state.ResumeTiming();
+    }
+}
+
+// The time until the response of a local server is stored, i.e. starting, running and exiting the download program.
+void version_check_round_trip(benchmark::State & state)
+{
+    sharg::detail::version_checker checker = make_checker();
+
+    for (auto _ : state)
+    {
+        std::promise<bool> prom{};
+        std::future<bool> future = prom.get_future();
+        checker(std::move(prom));
+
+        if (!future.get())
+        {
+            state.SkipWithError("The download program failed.");
+            break;
+        }
+    }
+}
+
+BENCHMARK(version_check_start)->UseRealTime();
+BENCHMARK(version_check_round_trip)->UseRealTime();
@@ -0,0 +1,476 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <benchmark/benchmark.h>
+
+#include <sharg/parser.hpp>
+#include <sharg/parser_schema.hpp>
+#include <sharg/static_schema.hpp>
+#include <sharg/string_pool.hpp>
+
+namespace bench
+{
+
+enum class colour : uint8_t
+{
+    red,
+    green,
+    blue
+};
+
+auto enumeration_names(colour)
+{
+    return std::unordered_map<std::string_view, colour>{{"red", colour::red},
+                                                        {"green", colour::green},
+                                                        {"blue", colour::blue}};
+}
+
+enum class table_colour : uint8_t
+{
+    red,
+    green,
+    blue
+};
+
+constexpr auto enumeration_names(table_colour)
+{
+    return sharg::enumeration_table<table_colour, 3>{
+        {{"red", table_colour::red}, {"green", table_colour::green}, {"blue", table_colour::blue}}};
+}
+
+// The options of a typical tool, used to compare sharg::parser, sharg::parser_schema and sharg::static_schema.
+struct tool_options
+{
+    int threads{1};
+    double error_rate{0.1};
+    std::string output{};
+    std::vector<std::string> includes{};
+    bool verbose{false};
+    bool force{false};
+    colour highlight{colour::red};
+    std::string input{};
+    std::vector<std::string> files{};
+};
+
+// The command line of the tool.
+std::vector<std::string> const tool_arguments{"-t",
+                                              "8",
+                                              "--error-rate",
+                                              "0.05",
+                                              "-o",
+                                              "out.txt",
+                                              "-I",
+                                              "inc/a",
+                                              "-I",
+                                              "inc/b",
+                                              "-vf",
+                                              "--highlight",
+                                              "blue",
+                                              "in.fa",
+                                              "x.fa",
+                                              "y.fa",
+                                              "z.fa"};
+
+} // namespace bench
+
+// Owns a command line and provides it as argc/argv, such that the parser does not copy the arguments.
+struct command_line
+{
+    explicit command_line(std::vector<std::string> arguments) : arguments{std::move(arguments)}
+    {
+        argv.reserve(this->arguments.size());
+        for (std::string const & arg : this->arguments)
+            argv.push_back(arg.c_str());
+    }
+
+    sharg::parser parser() const
+    {
+        return sharg::parser{sharg::borrow_arguments,
+                             "benchmark",
+                             static_cast<int>(argv.size()),
+                             argv.data(),
+                             sharg::update_notifications::off};
+    }
+
+    std::vector<std::string> arguments;
+    std::vector<char const *> argv;
+};
+
+// Registers `option_count` integer options and parses a command line that sets the first `argument_count` of them.
+void options_by_arguments(benchmark::State & state)
+{
+    size_t const option_count = state.range(0);
+    size_t const argument_count = state.range(1);
+
+    std::vector<std::string> long_ids(option_count);
+    for (size_t i = 0; i < option_count; ++i)
+        long_ids[i] = "option-" + std::to_string(i);
+
+    std::vector<std::string> arguments{"./benchmark"};
+    for (size_t i = 0; i < argument_count; ++i)
+    {
+        arguments.push_back("--" + long_ids[i]);
+        arguments.push_back(std::to_string(i));
+    }
+
+    command_line const cmd{std::move(arguments)};
+    std::vector<int> values(option_count);
+
+    for (auto _ : state)
+    {
+        sharg::parser parser = cmd.parser();
+
+        for (size_t i = 0; i < option_count; ++i)
+            parser.add_option(values[i], sharg::config{.long_id = long_ids[i]});
+
+        parser.parse();
+        benchmark::DoNotOptimize(values.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * argument_count);
+}
+
+// Parses a single cluster of `flag_count` short flags, e.g. `-abc`. `h` is reserved for the help page.
+void flag_cluster(benchmark::State & state)
+{
+    static constexpr std::string_view short_ids{"abcdefgijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789"};
+    size_t const flag_count = state.range(0);
+
+    command_line const cmd{{"./benchmark", "-" + std::string{short_ids.substr(0, flag_count)}}};
+    std::unique_ptr<bool[]> values{new bool[flag_count]};
+
+    for (auto _ : state)
+    {
+        sharg::parser parser = cmd.parser();
+
+        for (size_t i = 0; i < flag_count; ++i)
+        {
+            values[i] = false;
+            parser.add_flag(values[i], sharg::config{.short_id = short_ids[i]});
+        }
+
+        parser.parse();
+        benchmark::DoNotOptimize(values.get());
+    }
+
+    state.SetItemsProcessed(state.iterations() * flag_count);
+}
+
+// Parses `value_count` values into a container option, alternating between `-i value` and `-ivalue`.
+void container_option(benchmark::State & state)
+{
+    size_t const value_count = state.range(0);
+
+    std::vector<std::string> arguments{"./benchmark"};
+    arguments.reserve(value_count * 2u);
+    for (size_t i = 0; i < value_count; ++i)
+    {
+        if (i % 2u == 0u)
+        {
+            arguments.push_back("-i");
+            arguments.push_back(std::to_string(i));
+        }
+        else
+        {
+            arguments.push_back("-i" + std::to_string(i));
+        }
+    }
+
+    command_line const cmd{std::move(arguments)};
+    std::vector<int> values;
+
+    for (auto _ : state)
+    {
+        sharg::parser parser = cmd.parser();
+        parser.add_option(values, sharg::config{.short_id = 'i'});
+        parser.parse();
+        benchmark::DoNotOptimize(values.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * value_count);
+}
+
+// Parses `value_count` values given as a single comma-separated list, e.g. `--ids 0,1,2`.
+void list_option(benchmark::State & state)
+{
+    size_t const value_count = state.range(0);
+
+    std::string list{};
+    for (size_t i = 0; i < value_count; ++i)
+        list += std::to_string(i) + ',';
+    list.pop_back();
+
+    command_line const cmd{{"./benchmark", "--ids", std::move(list)}};
+    std::vector<int> values;
+
+    for (auto _ : state)
+    {
+        sharg::parser parser = cmd.parser();
+        parser.add_option(values, sharg::config{.long_id = "ids", .list_delimiter = ','});
+        parser.parse();
+        benchmark::DoNotOptimize(values.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * value_count);
+}
+
+// Parses `value_count` file names given as positional arguments into a container of strings.
+template <typename container_t>
+void string_list_option(benchmark::State & state)
+{
+    size_t const value_count = state.range(0);
+
+    std::vector<std::string> arguments{"./benchmark"};
+    arguments.reserve(value_count + 1u);
+    for (size_t i = 0; i < value_count; ++i)
+        arguments.push_back("/data/project/samples/sample_" + std::to_string(i) + ".fastq.gz");
+
+    command_line const cmd{std::move(arguments)};
+
+    for (auto _ : state)
+    {
+        container_t values{};
+        sharg::parser parser = cmd.parser();
+        parser.add_positional_option(values, sharg::config{});
+        parser.parse();
+        benchmark::DoNotOptimize(values.begin());
+    }
+
+    state.SetItemsProcessed(state.iterations() * value_count);
+}
+
+// Parses `value_count` enumeration values given by their names into a container option.
+template <typename colour_t>
+void enumeration_option(benchmark::State & state)
+{
+    static constexpr std::array<std::string_view, 3> names{"red", "green", "blue"};
+    size_t const value_count = state.range(0);
+
+    std::vector<std::string> arguments{"./benchmark"};
+    arguments.reserve(value_count * 2u);
+    for (size_t i = 0; i < value_count; ++i)
+    {
+        arguments.push_back("--colour");
+        arguments.emplace_back(names[i % names.size()]);
+    }
+
+    command_line const cmd{std::move(arguments)};
+    std::vector<colour_t> values;
+
+    for (auto _ : state)
+    {
+        sharg::parser parser = cmd.parser();
+        parser.add_option(values, sharg::config{.long_id = "colour"});
+        parser.parse();
+        benchmark::DoNotOptimize(values.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * value_count);
+}
+
+// Parses many std::filesystem::path values, e.g. a list of input files.
+void path_option(benchmark::State & state)
+{
+    size_t const value_count = state.range(0);
+
+    std::vector<std::string> arguments{"./benchmark"};
+    arguments.reserve(value_count * 2u);
+    for (size_t i = 0; i < value_count; ++i)
+    {
+        arguments.push_back("--input");
+        arguments.push_back("data/sample_" + std::to_string(i) + ".fastq.gz");
+    }
+
+    command_line const cmd{std::move(arguments)};
+    std::vector<std::filesystem::path> values;
+
+    for (auto _ : state)
+    {
+        values.clear();
+        sharg::parser parser = cmd.parser();
+        parser.add_option(values, sharg::config{.long_id = "input"});
+        parser.parse();
+        benchmark::DoNotOptimize(values.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * value_count);
+}
+
+// Like options_by_arguments, but the options are added to a sharg::parser_schema once and only parsing is repeated.
+void schema_options_by_arguments(benchmark::State & state)
+{
+    size_t const option_count = state.range(0);
+    size_t const argument_count = state.range(1);
+
+    std::vector<std::string> arguments{};
+    for (size_t i = 0; i < argument_count; ++i)
+    {
+        arguments.push_back("--option-" + std::to_string(i));
+        arguments.push_back(std::to_string(i));
+    }
+    std::vector<std::string_view> const views(arguments.begin(), arguments.end());
+
+    struct options_type
+    {
+        std::vector<int> values{};
+    };
+
+    // Each option is bound to the same container member; a container option may be given multiple times.
+    sharg::parser_schema<options_type> schema{};
+    for (size_t i = 0; i < option_count; ++i)
+        schema.add_option(&options_type::values, sharg::config{.long_id = "option-" + std::to_string(i)});
+
+    for (auto _ : state)
+    {
+        options_type const options = schema.parse(views);
+        benchmark::DoNotOptimize(options.values.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * argument_count);
+}
+
+// Adds the options of bench::tool_options to a sharg::parser and parses bench::tool_arguments.
+void tool_parser(benchmark::State & state)
+{
+    std::vector<std::string> arguments{"./benchmark"};
+    arguments.insert(arguments.end(), bench::tool_arguments.begin(), bench::tool_arguments.end());
+    command_line const cmd{std::move(arguments)};
+
+    for (auto _ : state)
+    {
+        bench::tool_options options{};
+        sharg::parser parser = cmd.parser();
+        parser.add_option(options.threads,
+                          sharg::config{.short_id = 't',
+                                        .long_id = "threads",
+                                        .validator = sharg::arithmetic_range_validator{1, 64}});
+        parser.add_option(options.error_rate, sharg::config{.long_id = "error-rate"});
+        parser.add_option(options.output, sharg::config{.short_id = 'o'});
+        parser.add_option(options.includes, sharg::config{.short_id = 'I'});
+        parser.add_flag(options.verbose, sharg::config{.short_id = 'v'});
+        parser.add_flag(options.force, sharg::config{.short_id = 'f', .long_id = "force"});
+        parser.add_option(options.highlight, sharg::config{.long_id = "highlight"});
+        parser.add_positional_option(options.input, sharg::config{});
+        parser.add_positional_option(options.files, sharg::config{});
+        parser.parse();
+        benchmark::DoNotOptimize(options.files.data());
+    }
+}
+
+// Parses bench::tool_arguments with a sharg::parser_schema that is set up once.
+void tool_parser_schema(benchmark::State & state)
+{
+    std::vector<std::string_view> const views(bench::tool_arguments.begin(), bench::tool_arguments.end());
+
+    sharg::parser_schema<bench::tool_options> schema{};
+    schema.add_option(&bench::tool_options::threads,
+                      sharg::config{.short_id = 't',
+                                    .long_id = "threads",
+                                    .validator = sharg::arithmetic_range_validator{1, 64}});
+    schema.add_option(&bench::tool_options::error_rate, sharg::config{.long_id = "error-rate"});
+    schema.add_option(&bench::tool_options::output, sharg::config{.short_id = 'o'});
+    schema.add_option(&bench::tool_options::includes, sharg::config{.short_id = 'I'});
+    schema.add_flag(&bench::tool_options::verbose, sharg::config{.short_id = 'v'});
+    schema.add_flag(&bench::tool_options::force, sharg::config{.short_id = 'f', .long_id = "force"});
+    schema.add_option(&bench::tool_options::highlight, sharg::config{.long_id = "highlight"});
+    schema.add_positional_option(&bench::tool_options::input, sharg::config{});
+    schema.add_positional_option(&bench::tool_options::files, sharg::config{});
+
+    for (auto _ : state)
+    {
+        bench::tool_options const options = schema.parse(views);
+        benchmark::DoNotOptimize(options.files.data());
+    }
+}
+
+// Parses bench::tool_arguments with a sharg::static_schema.
+void tool_static_schema(benchmark::State & state)
+{
+    std::vector<std::string_view> const views(bench::tool_arguments.begin(), bench::tool_arguments.end());
+
+    sharg::static_schema const schema{
+        sharg::static_option<'t', "threads">(&bench::tool_options::threads,
+                                             sharg::config{.validator = sharg::arithmetic_range_validator{1, 64}}),
+        sharg::static_option<"error-rate">(&bench::tool_options::error_rate),
+        sharg::static_option<'o'>(&bench::tool_options::output),
+        sharg::static_option<'I'>(&bench::tool_options::includes),
+        sharg::static_flag<'v'>(&bench::tool_options::verbose),
+        sharg::static_flag<'f', "force">(&bench::tool_options::force),
+        sharg::static_option<"highlight">(&bench::tool_options::highlight),
+        sharg::static_positional_option(&bench::tool_options::input),
+        sharg::static_positional_option(&bench::tool_options::files)};
+
+    for (auto _ : state)
+    {
+        bench::tool_options const options = schema.parse(views);
+        benchmark::DoNotOptimize(options.files.data());
+    }
+}
+
+// Queries is_option_set for each of `option_count` options after parsing a command line that sets every option.
+void is_option_set(benchmark::State & state)
+{
+    size_t const option_count = state.range(0);
+
+    std::vector<std::string> long_ids(option_count);
+    std::vector<std::string> arguments{"./benchmark"};
+    for (size_t i = 0; i < option_count; ++i)
+    {
+        long_ids[i] = "option-" + std::to_string(i);
+        arguments.push_back("--" + long_ids[i]);
+        arguments.push_back(std::to_string(i));
+    }
+
+    command_line const cmd{std::move(arguments)};
+    std::vector<int> values(option_count);
+    sharg::parser parser = cmd.parser();
+
+    for (size_t i = 0; i < option_count; ++i)
+        parser.add_option(values[i], sharg::config{.long_id = long_ids[i]});
+
+    parser.parse();
+
+    for (auto _ : state)
+    {
+        for (std::string const & id : long_ids)
+            benchmark::DoNotOptimize(parser.is_option_set(id));
+    }
+
+    state.SetItemsProcessed(state.iterations() * option_count);
+}
+
+BENCHMARK(options_by_arguments)
+    ->ArgNames({"options", "arguments"})
+    ->Args({100, 10})
+    ->Args({100, 100})
+    ->Args({1'000, 100})
+    ->Args({1'000, 1'000})
+    ->Args({10'000, 1'000})
+    ->Args({10'000, 10'000});
+BENCHMARK(schema_options_by_arguments)
+    ->ArgNames({"options", "arguments"})
+    ->Args({100, 10})
+    ->Args({100, 100})
+    ->Args({1'000, 100})
+    ->Args({1'000, 1'000})
+    ->Args({10'000, 1'000})
+    ->Args({10'000, 10'000});
+BENCHMARK(flag_cluster)->Arg(1)->Arg(8)->Arg(32)->Arg(61);
+BENCHMARK(container_option)->RangeMultiplier(10)->Range(100'000, 1'000'000)->Unit(benchmark::kMillisecond);
+BENCHMARK(list_option)->RangeMultiplier(10)->Range(100'000, 1'000'000)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(string_list_option, std::vector<std::string>)
+    ->RangeMultiplier(10)
+    ->Range(100'000, 1'000'000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(string_list_option, sharg::string_pool)
+    ->RangeMultiplier(10)
+    ->Range(100'000, 1'000'000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(enumeration_option, bench::colour)->RangeMultiplier(10)->Range(1'000, 100'000);
+BENCHMARK_TEMPLATE(enumeration_option, bench::table_colour)->RangeMultiplier(10)->Range(1'000, 100'000);
+BENCHMARK(path_option)->RangeMultiplier(10)->Range(1'000, 100'000);
+BENCHMARK(tool_parser);
+BENCHMARK(tool_parser_schema);
+BENCHMARK(tool_static_schema);
+BENCHMARK(is_option_set)->RangeMultiplier(10)->Range(10, 1'000);
@@ -0,0 +1,67 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <benchmark/benchmark.h>
+
+#include <sharg/parser.hpp>
+
+// Long identifiers of the form "option-<i>" for `count` options.
+std::vector<std::string> generate_long_ids(size_t const count)
+{
+    std::vector<std::string> long_ids(count);
+
+    for (size_t i = 0; i < count; ++i)
+        long_ids[i] = "option-" + std::to_string(i);
+
+    return long_ids;
+}
+
+// Registers `long_ids.size()` options, each option being checked against all identifiers registered before.
+void add_option(benchmark::State & state)
+{
+    size_t const option_count = state.range(0);
+    std::vector<std::string> const long_ids = generate_long_ids(option_count);
+    std::vector<int> values(option_count);
+
+    for (auto _ : state)
+    {
+        sharg::parser parser{"benchmark", std::vector<std::string>{"./benchmark"}, sharg::update_notifications::off};
+
+        for (size_t i = 0; i < option_count; ++i)
+            parser.add_option(values[i], sharg::config{.long_id = long_ids[i]});
+
+        benchmark::DoNotOptimize(parser);
+    }
+
+    state.SetComplexityN(state.range(0));
+}
+
+// Queries options of a parser that has `option_count` options registered.
+void is_option_set(benchmark::State & state)
+{
+    size_t const option_count = state.range(0);
+    std::vector<std::string> const long_ids = generate_long_ids(option_count);
+    std::vector<int> values(option_count);
+
+    sharg::parser parser{"benchmark",
+                         std::vector<std::string>{"./benchmark", "--" + long_ids.back(), "1"},
+                         sharg::update_notifications::off};
+
+    for (size_t i = 0; i < option_count; ++i)
+        parser.add_option(values[i], sharg::config{.long_id = long_ids[i]});
+
+    parser.parse();
+
+    size_t i{};
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(parser.is_option_set(long_ids[i]));
+        i = (i + 1u == option_count) ? 0u : i + 1u;
+    }
+
+    state.SetComplexityN(state.range(0));
+}
+
+BENCHMARK(add_option)->RangeMultiplier(10)->Range(100, 10'000)->Complexity();
+BENCHMARK(is_option_set)->RangeMultiplier(10)->Range(100, 10'000)->Complexity();
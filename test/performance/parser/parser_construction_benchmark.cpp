@@ -0,0 +1,66 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <benchmark/benchmark.h>
+
+#include <regex>
+
+#include <sharg/parser.hpp>
+
+// Constructs a parser, i.e. the start-up cost of every application before any option is added.
+void parser_construction(benchmark::State & state)
+{
+    std::array<char const *, 3> const argv{"./benchmark", "-i", "1"};
+
+    for (auto _ : state)
+    {
+        sharg::parser parser{"benchmark", static_cast<int>(argv.size()), argv.data(), sharg::update_notifications::off};
+        benchmark::DoNotOptimize(parser);
+    }
+}
+
+// Constructs a parser with `subcommand_count` subcommands; the last one is called.
+void parser_construction_subcommands(benchmark::State & state)
+{
+    size_t const subcommand_count = state.range(0);
+
+    std::vector<std::string> subcommands(subcommand_count);
+    for (size_t i = 0; i < subcommand_count; ++i)
+        subcommands[i] = "subcommand-" + std::to_string(i);
+
+    std::array<char const *, 2> const argv{"./benchmark", subcommands.back().c_str()};
+
+    for (auto _ : state)
+    {
+        sharg::parser parser{"benchmark",
+                             static_cast<int>(argv.size()),
+                             argv.data(),
+                             sharg::update_notifications::off,
+                             subcommands};
+        benchmark::DoNotOptimize(parser);
+    }
+}
+
+// The check of the application name, as done by the parser on construction.
+void app_name_check(benchmark::State & state)
+{
+    std::string const app_name{"my_application-name"};
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(sharg::detail::app_name_chars.matches(app_name));
+}
+
+// For comparison: The same check with a regex, as it was done by the parser before.
+void app_name_check_regex(benchmark::State & state)
+{
+    std::string const app_name{"my_application-name"};
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(std::regex_match(app_name, std::regex{"^[a-zA-Z0-9_-]+$"}));
+}
+
+BENCHMARK(parser_construction);
+BENCHMARK(parser_construction_subcommands)->RangeMultiplier(4)->Range(1, 64);
+BENCHMARK(app_name_check);
+BENCHMARK(app_name_check_regex);
@@ -0,0 +1,172 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <benchmark/benchmark.h>
+
+#include <fstream>
+#include <numeric>
+
+#include <sharg/test/tmp_filename.hpp>
+#include <sharg/validators.hpp>
+
+// Validates `value_count` integers at once, i.e. the validator is applied to a container option.
+void arithmetic_range_validator(benchmark::State & state)
+{
+    size_t const value_count = state.range(0);
+    std::vector<int> values(value_count);
+    std::iota(values.begin(), values.end(), 0);
+
+    sharg::arithmetic_range_validator const validator{0, static_cast<int>(value_count)};
+
+    for (auto _ : state)
+        validator(values);
+
+    state.SetItemsProcessed(state.iterations() * value_count);
+}
+
+// Validates a value against a list of `list_size` integers. The value is the last element of the list.
+void value_list_validator_int(benchmark::State & state)
+{
+    size_t const list_size = state.range(0);
+    std::vector<int> valid_values(list_size);
+    std::iota(valid_values.begin(), valid_values.end(), 0);
+
+    sharg::value_list_validator const validator{valid_values};
+    int const value = valid_values.back();
+
+    for (auto _ : state)
+        validator(value);
+}
+
+// Validates a value against a list of `list_size` strings. The value is the last element of the list.
+void value_list_validator_string(benchmark::State & state)
+{
+    size_t const list_size = state.range(0);
+    std::vector<std::string> valid_values(list_size);
+    for (size_t i = 0; i < list_size; ++i)
+        valid_values[i] = "value-" + std::to_string(i);
+
+    sharg::value_list_validator const validator{valid_values};
+    std::string const value = valid_values.back();
+
+    for (auto _ : state)
+        validator(value);
+}
+
+// Validates an e-mail address.
+void regex_validator(benchmark::State & state)
+{
+    sharg::regex_validator const validator{"[a-zA-Z.]+@[a-zA-Z.]+\\.(com|net|org)"};
+    std::string const value{"sharg.parser@seqan.org"};
+
+    for (auto _ : state)
+        validator(value);
+}
+
+// Validates an e-mail address with a pattern that is matched without std::regex.
+void regex_validator_automaton(benchmark::State & state)
+{
+    sharg::regex_validator const validator{"[a-zA-Z.]+@[a-zA-Z.]+\\.org"};
+    std::string const value{"sharg.parser@seqan.org"};
+
+    for (auto _ : state)
+        validator(value);
+}
+
+// Validates `value_count` sample IDs at once. Argument 0 selects a pattern that is matched by std::regex.
+void regex_validator_container(benchmark::State & state)
+{
+    size_t const value_count = state.range(0);
+    std::vector<std::string> values(value_count);
+    for (size_t i = 0; i < value_count; ++i)
+        values[i] = "sample_" + std::to_string(i);
+
+    sharg::regex_validator const validator{state.range(1) ? "sample_[0-9]+" : "sample_([0-9]+)"};
+
+    for (auto _ : state)
+        validator(values);
+
+    state.SetItemsProcessed(state.iterations() * value_count);
+}
+
+// Constructs a regex_validator, i.e. compiles the pattern.
+void regex_validator_construction(benchmark::State & state)
+{
+    for (auto _ : state)
+    {
+        sharg::regex_validator validator{"[a-zA-Z.]+@[a-zA-Z.]+\\.(com|net|org)"};
+        benchmark::DoNotOptimize(validator);
+    }
+}
+
+// Validates an existing, readable file with a valid extension.
+void input_file_validator(benchmark::State & state)
+{
+    sharg::test::tmp_filename const tmp_file{"input.fasta"};
+    std::ofstream{tmp_file.get_path()} << ">seq\nACGT\n";
+
+    sharg::input_file_validator const validator{{"fa", "fasta"}};
+
+    for (auto _ : state)
+        validator(tmp_file.get_path());
+}
+
+// Validates a not yet existing, writable file with a valid extension.
+void output_file_validator(benchmark::State & state)
+{
+    sharg::test::tmp_filename const tmp_file{"output.fasta"};
+
+    sharg::output_file_validator const validator{sharg::output_file_open_options::create_new, {"fa", "fasta"}};
+
+    for (auto _ : state)
+        validator(tmp_file.get_path());
+}
+
+// Validates an existing, readable directory.
+void input_directory_validator(benchmark::State & state)
+{
+    sharg::test::tmp_filename const tmp_file{"input"};
+    std::filesystem::create_directory(tmp_file.get_path());
+
+    sharg::input_directory_validator const validator{};
+
+    for (auto _ : state)
+        validator(tmp_file.get_path());
+}
+
+// Validates an existing, writable directory.
+void output_directory_validator(benchmark::State & state)
+{
+    sharg::test::tmp_filename const tmp_file{"output"};
+    std::filesystem::create_directory(tmp_file.get_path());
+
+    sharg::output_directory_validator const validator{};
+
+    for (auto _ : state)
+        validator(tmp_file.get_path());
+}
+
+// Validates a value with a chain of validators.
+void validator_chain(benchmark::State & state)
+{
+    auto const validator = sharg::regex_validator{"[a-z0-9-]+"}
+                         | sharg::value_list_validator{"value-1", "value-2", "value-3", "value-4", "value-5"};
+    std::string const value{"value-5"};
+
+    for (auto _ : state)
+        validator(value);
+}
+
+BENCHMARK(arithmetic_range_validator)->RangeMultiplier(10)->Range(1'000, 1'000'000);
+BENCHMARK(value_list_validator_int)->RangeMultiplier(10)->Range(10, 10'000);
+BENCHMARK(value_list_validator_string)->RangeMultiplier(10)->Range(10, 10'000);
+BENCHMARK(regex_validator);
+BENCHMARK(regex_validator_automaton);
+BENCHMARK(regex_validator_container)->ArgsProduct({{1'000, 200'000}, {0, 1}});
+BENCHMARK(regex_validator_construction);
+BENCHMARK(input_file_validator);
+BENCHMARK(output_file_validator);
+BENCHMARK(input_directory_validator);
+BENCHMARK(output_directory_validator);
+BENCHMARK(validator_chain);
@@ -0,0 +1,72 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <charconv>
+#include <system_error>
+
+#include <sharg/all.hpp>
+
+namespace external
+{
+// A type given as "begin-end", e.g. "100-250".
+struct region
+{
+    int begin{};
+    int end{};
+};
+
+// Needed to print the default value on the help page.
+std::ostream & operator<<(std::ostream & stream, region const & value)
+{
+    return stream << value.begin << '-' << value.end;
+}
+
+} // namespace external
+
+namespace sharg::custom
+{
+// Specialise the sharg::custom::parsing data structure to parse external::region without a std::istringstream.
+template <>
+struct parsing<external::region>
+{
+    static std::errc from_chars(std::string_view const in, external::region & value)
+    {
+        char const * const end = in.data() + in.size();
+        auto res = std::from_chars(in.data(), end, value.begin);
+
+        if (res.ec != std::errc{} || res.ptr == end || *res.ptr != '-')
+            return std::errc::invalid_argument;
+
+        res = std::from_chars(res.ptr + 1, end, value.end);
+
+        if (res.ec != std::errc{})
+            return res.ec; // e.g. std::errc::result_out_of_range
+        if (res.ptr != end || value.end < value.begin)
+            return std::errc::invalid_argument;
+
+        return std::errc{};
+    }
+};
+
+} // namespace sharg::custom
+
+int main(int argc, char const * argv[])
+{
+    external::region value{};
+
+    sharg::parser parser{"my_program", argc, argv};
+    parser.add_option(value, sharg::config{.short_id = 'r', .long_id = "region", .description = "A region."});
+
+    try
+    {
+        parser.parse();
+    }
+    catch (sharg::parser_error const & ext) // the user did something wrong
+    {
+        std::cerr << "[PARSER ERROR] " << ext.what() << "\n"; // customize your error message
+        return -1;
+    }
+
+    return 0;
+}
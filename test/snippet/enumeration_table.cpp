@@ -0,0 +1,36 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <sharg/all.hpp>
+
+namespace foo
+{
+
+enum class colour : uint8_t
+{
+    red,
+    green,
+    blue
+};
+
+// The table is built at compile time. "r" is an alias; "red" is printed because it is given first.
+constexpr auto enumeration_names(colour)
+{
+    return sharg::enumeration_table<colour, 4>{
+        {{"red", colour::red}, {"r", colour::red}, {"green", colour::green}, {"blue", colour::blue}}};
+}
+
+} // namespace foo
+
+// The names are known at compile time.
+static_assert(foo::enumeration_names(foo::colour{}).find("blue")->second == foo::colour::blue);
+
+int main()
+{
+    // Parsing "r" with a sharg::parser sets the value to foo::colour::red. Printing it prints its first name.
+    std::cout << "colour: " << sharg::enumeration_names<foo::colour>.find("r")->second << '\n';
+    std::cout << "names: " << sharg::enumeration_names<foo::colour>.size() << '\n';
+
+    return 0;
+}
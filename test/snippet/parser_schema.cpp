@@ -0,0 +1,38 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <sharg/all.hpp>
+
+struct job_options
+{
+    int threads{1};
+    bool verbose{false};
+    std::vector<std::string> files{};
+};
+
+int main()
+{
+    // Set up once.
+    sharg::parser_schema<job_options> schema{};
+    schema.add_option(&job_options::threads,
+                      sharg::config{.short_id = 't', .validator = sharg::arithmetic_range_validator{1, 64}});
+    schema.add_flag(&job_options::verbose, sharg::config{.short_id = 'v'});
+    schema.add_positional_option(&job_options::files, sharg::config{});
+
+    // Parse any number of command lines, e.g. one per request, also concurrently.
+    std::vector<std::string_view> const request{"-t", "8", "-v", "a.fa", "b.fa"};
+
+    try
+    {
+        job_options const options = schema.parse(request);
+        std::cout << "threads: " << options.threads << ", files: " << options.files.size() << '\n';
+    }
+    catch (sharg::parser_error const & ext) // the request is invalid
+    {
+        std::cerr << "[PARSER ERROR] " << ext.what() << '\n';
+        return -1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,35 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <sharg/all.hpp>
+
+int main(int argc, char ** argv)
+{
+    sharg::parser myparser{"Penguin_Parade", argc, argv}; // initialize
+
+    size_t total_weight{};
+    // Each weight is validated and added to the total before the next one is parsed. No list is stored.
+    auto add_weight = [&total_weight](size_t const weight)
+    {
+        total_weight += weight;
+    };
+
+    myparser.add_positional_option_sink<size_t>(add_weight,
+                                                sharg::config{.description = "The weights of the penguins.",
+                                                              .validator = sharg::arithmetic_range_validator{1, 50}});
+
+    try
+    {
+        myparser.parse(); // trigger command line parsing
+    }
+    catch (sharg::parser_error const & ext) // catch user errors
+    {
+        std::cerr << "[Winter has come] " << ext.what() << "\n"; // customise your error message
+        return -1;
+    }
+
+    std::cout << "The penguins weigh " << total_weight << " kg in total.\n";
+
+    return 0;
+}
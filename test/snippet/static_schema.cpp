@@ -0,0 +1,38 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <sharg/all.hpp>
+
+struct job_options
+{
+    int threads{1};
+    bool verbose{false};
+    std::vector<std::string> files{};
+};
+
+int main()
+{
+    // The identifiers are template arguments; e.g. using 't' twice does not compile.
+    sharg::static_schema const schema{
+        sharg::static_option<'t', "threads">(&job_options::threads,
+                                             sharg::config{.validator = sharg::arithmetic_range_validator{1, 64}}),
+        sharg::static_flag<'v'>(&job_options::verbose),
+        sharg::static_positional_option(&job_options::files)};
+
+    // Parse any number of command lines, e.g. one per request, also concurrently.
+    std::vector<std::string_view> const request{"--threads", "8", "-v", "a.fa", "b.fa"};
+
+    try
+    {
+        job_options const options = schema.parse(request);
+        std::cout << "threads: " << options.threads << ", files: " << options.files.size() << '\n';
+    }
+    catch (sharg::parser_error const & ext) // the request is invalid
+    {
+        std::cerr << "[PARSER ERROR] " << ext.what() << '\n';
+        return -1;
+    }
+
+    return 0;
+}
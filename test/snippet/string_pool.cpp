@@ -0,0 +1,30 @@
+// SPDX-FileCopyrightText: 2006-2026 Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026 Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <sharg/all.hpp>
+
+int main()
+{
+    std::vector<std::string> arguments{"./my_program", "sample_1.fq", "sample_2.fq", "sample_3.fq"};
+    sharg::parser parser{"my_program", arguments, sharg::update_notifications::off};
+
+    // Stores the characters of all files in a single buffer instead of one std::string per file.
+    sharg::string_pool files{};
+    parser.add_positional_option(files, sharg::config{.description = "The input files."});
+
+    try
+    {
+        parser.parse();
+    }
+    catch (sharg::parser_error const & ext) // the user did something wrong
+    {
+        std::cerr << "[PARSER ERROR] " << ext.what() << '\n';
+        return -1;
+    }
+
+    for (std::string_view const file : files)
+        std::cout << file << '\n';
+
+    return 0;
+}
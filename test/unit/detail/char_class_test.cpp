@@ -0,0 +1,63 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <sharg/detail/char_class.hpp>
+
+TEST(char_class_test, contains)
+{
+    constexpr sharg::detail::char_class abc{"abc"};
+
+    EXPECT_TRUE(abc.contains('a'));
+    EXPECT_TRUE(abc.contains('c'));
+    EXPECT_FALSE(abc.contains('d'));
+    EXPECT_FALSE(abc.contains('\0'));
+    EXPECT_FALSE(abc.contains(static_cast<char>(0xE1))); // Not sign extended into the set.
+
+    EXPECT_EQ(abc.prefix_length("abcd"), 3u);
+    EXPECT_EQ(abc.prefix_length("dabc"), 0u);
+    EXPECT_EQ(abc.prefix_length(""), 0u);
+}
+
+TEST(char_class_test, app_name_chars)
+{
+    using sharg::detail::app_name_chars;
+
+    static_assert(app_name_chars.matches("app_name-1"));
+
+    EXPECT_TRUE(app_name_chars.matches("test_parser"));
+    EXPECT_TRUE(app_name_chars.matches("Test-Parser_2"));
+    EXPECT_TRUE(app_name_chars.matches("-"));
+    EXPECT_FALSE(app_name_chars.matches(""));
+    EXPECT_FALSE(app_name_chars.matches("test parser"));
+    EXPECT_FALSE(app_name_chars.matches("test;rm -rf"));
+    EXPECT_FALSE(app_name_chars.matches("test\n"));
+    EXPECT_FALSE(app_name_chars.matches("t\xC3\xA9st"));
+    EXPECT_FALSE(app_name_chars.matches(std::string_view{"test\0", 5}));
+}
+
+TEST(char_class_test, version_number)
+{
+    using sharg::detail::is_version_number;
+    using sharg::detail::version_prefix_length;
+
+    static_assert(is_version_number("1.2.3"));
+
+    EXPECT_EQ(version_prefix_length("1.2.3"), 5u);
+    EXPECT_EQ(version_prefix_length("10.20.300-rc.1"), 9u);
+    EXPECT_EQ(version_prefix_length("1.2.3.4"), 5u);
+    EXPECT_EQ(version_prefix_length("1.2"), 0u);
+    EXPECT_EQ(version_prefix_length("1.2."), 0u);
+    EXPECT_EQ(version_prefix_length("1..3"), 0u);
+    EXPECT_EQ(version_prefix_length("v1.2.3"), 0u);
+    EXPECT_EQ(version_prefix_length(""), 0u);
+
+    EXPECT_TRUE(is_version_number("0.0.0"));
+    EXPECT_TRUE(is_version_number("2023.12.1"));
+    EXPECT_FALSE(is_version_number("1.2.3-rc.1"));
+    EXPECT_FALSE(is_version_number("1.2.3 "));
+    EXPECT_FALSE(is_version_number("1.2"));
+    EXPECT_FALSE(is_version_number(""));
+}
@@ -0,0 +1,132 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <sharg/detail/compiled_regex.hpp>
+
+using namespace std::string_literals;
+
+// The automaton must accept exactly the strings that std::regex_match accepts.
+TEST(compiled_regex_test, automaton_matches_like_std_regex)
+{
+    std::vector<std::string> const patterns{"",
+                                            "abc",
+                                            "^chr[0-9XYM]+$",
+                                            "[a-zA-Z0-9_.-]{1,32}",
+                                            "[a-zA-Z.]+@[a-zA-Z.]+\\.com",
+                                            "\\d+\\.\\d+\\.\\d+",
+                                            "[^,;]*",
+                                            "[-a]b?[a-]",
+                                            "\\w\\W\\s\\S\\D",
+                                            "[\\d\\s]+x",
+                                            "a{2}b{0,3}c{2,}d{0,}",
+                                            "a?a?a?aaa",
+                                            ".*oll.*",
+                                            ".x*",
+                                            "[\\]\\\\\\-]+",
+                                            "\\$\\^\\.\\*\\+\\?\\(\\)\\[\\]\\{\\}\\|",
+                                            "\\t\\n\\r\\f\\v",
+                                            "\xC3\xA9[\xC3\xA9]*"};
+
+    std::vector<std::string> const values{"",
+                                          "abc",
+                                          "ab",
+                                          "abcc",
+                                          "chr1",
+                                          "chr22X",
+                                          "chr",
+                                          "Chr1",
+                                          "sample_01.v2-final",
+                                          "a-very-long-identifier-of-more-than-32-characters",
+                                          "sharg.parser@seqan.com",
+                                          "sharg@seqan.org",
+                                          "1.2.3",
+                                          "1.2.",
+                                          "10.200.3000",
+                                          "a,b",
+                                          "ab;",
+                                          "ab-",
+                                          "-a",
+                                          "a_ !1",
+                                          "a_ !a",
+                                          "1 2\t3x",
+                                          "x",
+                                          "aac",
+                                          "aabbbccd",
+                                          "aabbbbcc",
+                                          "aacccccddd",
+                                          "aaa",
+                                          "aaaaaa",
+                                          "aaaaaaa",
+                                          "rollo",
+                                          "bttllo",
+                                          "\nx",
+                                          "\rx",
+                                          "\0xx"s,
+                                          "]\\-",
+                                          "$^.*+?()[]{}|",
+                                          "\t\n\r\f\v",
+                                          "\xC3\xA9\xC3\xA9",
+                                          "\xC3\xA9\xC3"};
+
+    for (std::string const & pattern : patterns)
+    {
+        std::optional<sharg::detail::regex_automaton> const automaton =
+            sharg::detail::regex_automaton::compile(pattern);
+        ASSERT_TRUE(automaton.has_value()) << pattern;
+
+        std::regex const regex{pattern};
+
+        for (std::string const & value : values)
+            EXPECT_EQ(automaton->matches(value), std::regex_match(value, regex)) << pattern << " on " << value;
+    }
+}
+
+TEST(compiled_regex_test, unsupported_patterns)
+{
+    for (std::string_view const pattern : {"(ab)+",
+                                           "a|b",
+                                           "a*?",
+                                           "a**",
+                                           "\\bword\\b",
+                                           "(a)\\1",
+                                           "[[:digit:]]+",
+                                           "[]a]",
+                                           "[a-\\d]",
+                                           "[\\x41]",
+                                           "a^b",
+                                           "a$b",
+                                           "a{64}",
+                                           "a{3,2}",
+                                           "a{",
+                                           "[abc",
+                                           "[z-a]",
+                                           "\\",
+                                           "[a-zA-Z0-9]{32}[a-zA-Z0-9]{32}"})
+    {
+        EXPECT_FALSE(sharg::detail::regex_automaton::compile(pattern).has_value()) << pattern;
+    }
+}
+
+TEST(compiled_regex_test, compiled_regex)
+{
+    std::smatch match{};
+
+    sharg::detail::compiled_regex const automaton{"[a-z]+[0-9]*"};
+    EXPECT_TRUE(automaton.uses_automaton());
+    EXPECT_TRUE(automaton.matches("sample42", match));
+    EXPECT_FALSE(automaton.matches("42sample", match));
+
+    sharg::detail::compiled_regex const regex{"(ab)+|c"};
+    EXPECT_FALSE(regex.uses_automaton());
+    EXPECT_TRUE(regex.matches("abab", match));
+    EXPECT_TRUE(regex.matches("c", match));
+    EXPECT_FALSE(regex.matches("abc", match));
+
+    // An invalid pattern is reported when matching.
+    std::optional<sharg::detail::compiled_regex> invalid{};
+    EXPECT_NO_THROW(invalid.emplace("(ab"));
+    EXPECT_THROW(invalid->matches("ab", match), std::regex_error);
+}
@@ -0,0 +1,80 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <numeric>
+
+#include <sharg/detail/parallel_validation.hpp>
+#include <sharg/exceptions.hpp>
+#include <sharg/test/expect_throw_msg.hpp>
+
+// Counts the validated values and throws for all values that are multiples of `invalid`.
+struct counting_validator
+{
+    void operator()(size_t const value) const
+    {
+        count->fetch_add(1u, std::memory_order_relaxed);
+
+        if (invalid != 0u && value % invalid == 0u)
+            throw sharg::validation_error{"Invalid value " + std::to_string(value) + "."};
+    }
+
+    std::atomic<size_t> * count;
+    size_t invalid{};
+};
+
+TEST(parallel_validation_test, validates_all_values)
+{
+    std::vector<size_t> values(10'000);
+    std::iota(values.begin(), values.end(), 1u);
+
+    for (size_t const thread_count : {0u, 1u, 2u, 7u, 64u})
+    {
+        std::atomic<size_t> count{};
+        EXPECT_NO_THROW(sharg::detail::parallel_validation{thread_count}(values, counting_validator{&count}));
+        EXPECT_EQ(count.load(), values.size());
+    }
+
+    // more threads than values
+    std::atomic<size_t> count{};
+    EXPECT_NO_THROW(sharg::detail::parallel_validation{64u}(std::vector<size_t>{1u, 2u}, counting_validator{&count}));
+    EXPECT_EQ(count.load(), 2u);
+
+    EXPECT_NO_THROW(sharg::detail::parallel_validation{}(std::vector<size_t>{}, counting_validator{&count}));
+    EXPECT_EQ(count.load(), 2u);
+}
+
+TEST(parallel_validation_test, reports_first_failure)
+{
+    std::vector<size_t> values(10'000);
+    std::iota(values.begin(), values.end(), 1u);
+    values[9'000] = 6'001u; // Invalid, but behind the first invalid value.
+    values[7'000] = 3'001u;
+
+    // The order in which the threads find the invalid values must not matter.
+    for (size_t repetition = 0; repetition < 20u; ++repetition)
+    {
+        std::atomic<size_t> count{};
+        EXPECT_THROW_MSG(sharg::detail::parallel_validation{8u}(values, counting_validator{&count, 3'001u}),
+                         sharg::validation_error,
+                         "Invalid value 3001.");
+        EXPECT_LE(count.load(), values.size());
+    }
+}
+
+TEST(parallel_validation_test, vector_bool)
+{
+    std::vector<bool> values(1'000, true);
+    values[500] = false;
+
+    EXPECT_THROW(sharg::detail::parallel_validation{4u}(values,
+                                                        [](bool const value)
+                                                        {
+                                                            if (!value)
+                                                                throw sharg::validation_error{"false"};
+                                                        }),
+                 sharg::validation_error);
+}
@@ -0,0 +1,156 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+
+#include <sys/stat.h>
+
+#include <sharg/detail/path_status.hpp>
+#include <sharg/test/file_access.hpp>
+#include <sharg/test/tmp_filename.hpp>
+#include <sharg/validators.hpp>
+
+#include "syscall_counter.hpp"
+
+class path_status_test : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        if (!SHARG_HAS_STATX)
+            GTEST_SKIP() << "statx is not available.";
+
+        std::ofstream{file.get_path()} << ">seq\nACGT\n";
+        std::filesystem::create_directory(directory.get_path());
+    }
+
+    sharg::test::tmp_filename const file{"input.fa"};
+    sharg::test::tmp_filename const directory{"directory"};
+    sharg::test::tmp_filename const missing{"missing.fa"};
+};
+
+TEST_F(path_status_test, fast_path_type)
+{
+    using sharg::detail::path_type;
+
+    EXPECT_EQ(sharg::detail::fast_path_type(file.get_path()), path_type::regular_file);
+    EXPECT_EQ(sharg::detail::fast_path_type(directory.get_path()), path_type::directory);
+    EXPECT_EQ(sharg::detail::fast_path_type(directory.get_path() / ""), path_type::directory);
+    EXPECT_EQ(sharg::detail::fast_path_type(missing.get_path()), path_type::not_found);
+    EXPECT_EQ(sharg::detail::fast_path_type(missing.get_path() / "file.fa"), path_type::not_found);
+    EXPECT_EQ(sharg::detail::fast_path_type(file.get_path() / "file.fa"), path_type::not_found); // Not a directory.
+    EXPECT_EQ(sharg::detail::fast_path_type(""), path_type::not_found);
+
+    sharg::test::tmp_filename const fifo{"fifo"};
+    mkfifo(fifo.get_path().c_str(), 0644);
+    EXPECT_EQ(sharg::detail::fast_path_type(fifo.get_path()), path_type::other);
+}
+
+TEST_F(path_status_test, fast_path_access)
+{
+    using sharg::detail::path_access;
+
+    EXPECT_TRUE(sharg::detail::fast_path_access(file.get_path(), path_access::read));
+    EXPECT_TRUE(sharg::detail::fast_path_access(file.get_path(), path_access::write));
+    EXPECT_TRUE(sharg::detail::fast_path_access(directory.get_path(), path_access::read));
+    EXPECT_TRUE(sharg::detail::fast_path_access(directory.get_path(), path_access::create));
+    EXPECT_FALSE(sharg::detail::fast_path_access(missing.get_path(), path_access::read));
+    EXPECT_FALSE(sharg::detail::fast_path_access(missing.get_path(), path_access::create));
+
+    std::filesystem::permissions(directory.get_path(),
+                                 std::filesystem::perms::owner_write | std::filesystem::perms::group_write
+                                     | std::filesystem::perms::others_write,
+                                 std::filesystem::perm_options::remove);
+
+    if (!sharg::test::write_access(directory.get_path() / "file")) // Do not execute with root permissions.
+    {
+        EXPECT_FALSE(sharg::detail::fast_path_access(directory.get_path(), path_access::create));
+    }
+
+    std::filesystem::permissions(directory.get_path(),
+                                 std::filesystem::perms::owner_write,
+                                 std::filesystem::perm_options::add);
+}
+
+// Pins the number of file system calls per validated path.
+TEST_F(path_status_test, validator_syscall_budget)
+{
+    if (!sharg::test::syscall_counter::is_loaded())
+        GTEST_SKIP() << "The syscall_counter is not preloaded.";
+
+    using sharg::test::syscall_counter::file_system_calls;
+
+    // Sanity check that calls are counted.
+    EXPECT_EQ(file_system_calls(
+                  [&]()
+                  {
+                      EXPECT_TRUE(std::filesystem::exists(file.get_path()));
+                  }),
+              1u);
+
+    std::filesystem::path const & file_path = file.get_path();
+    std::filesystem::path const & directory_path = directory.get_path();
+    std::filesystem::path const & missing_path = missing.get_path();
+
+    // statx + faccessat
+    EXPECT_EQ(file_system_calls(
+                  [&]()
+                  {
+                      sharg::input_file_validator{{"fa"}}(file_path);
+                  }),
+              2u);
+    EXPECT_EQ(file_system_calls(
+                  [&]()
+                  {
+                      sharg::output_file_validator{sharg::output_file_open_options::create_new, {"fa"}}(missing_path);
+                  }),
+              2u);
+    EXPECT_EQ(file_system_calls(
+                  [&]()
+                  {
+                      sharg::output_file_validator{sharg::output_file_open_options::open_or_create}(file_path);
+                  }),
+              2u);
+    EXPECT_EQ(file_system_calls(
+                  [&]()
+                  {
+                      sharg::input_directory_validator{}(directory_path);
+                  }),
+              2u);
+    EXPECT_EQ(file_system_calls(
+                  [&]()
+                  {
+                      sharg::output_directory_validator{}(directory_path);
+                  }),
+              2u);
+    EXPECT_EQ(file_system_calls(
+                  [&]()
+                  {
+                      sharg::output_directory_validator{}(missing_path);
+                  }),
+              2u);
+
+    // statx only
+    EXPECT_EQ(file_system_calls(
+                  [&]()
+                  {
+                      EXPECT_THROW(sharg::input_file_validator{}(missing_path), sharg::validation_error);
+                  }),
+              1u);
+
+    // Nothing was created or removed.
+    EXPECT_FALSE(std::filesystem::exists(missing_path));
+    EXPECT_EQ(std::filesystem::file_size(file_path), 10u);
+
+    // Container options: two calls per path.
+    std::vector<std::filesystem::path> const paths(100u, file_path);
+    EXPECT_EQ(file_system_calls(
+                  [&]()
+                  {
+                      sharg::input_file_validator{}(paths);
+                  }),
+              200u);
+}
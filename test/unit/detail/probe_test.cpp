@@ -0,0 +1,76 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <filesystem>
+
+#include <sharg/parser.hpp>
+#include <sharg/test/test_fixture.hpp>
+
+// Returns the notes of this test binary as listed by `readelf -n`, or an empty string if readelf is not available.
+static std::string read_notes()
+{
+    std::string notes{};
+    // /proc/self/exe would be readelf itself.
+    std::string const executable = std::filesystem::read_symlink("/proc/self/exe").string();
+    std::string const command = "readelf -n '" + executable + "' 2>/dev/null";
+
+    if (std::FILE * const pipe = popen(command.c_str(), "r"))
+    {
+        char buffer[4096];
+
+        for (size_t count; (count = std::fread(buffer, 1u, sizeof(buffer), pipe)) != 0u;)
+            notes.append(buffer, count);
+
+        pclose(pipe);
+    }
+
+    return notes;
+}
+
+class probe_test : public sharg::test::test_fixture
+{};
+
+// Parsing instantiates all probes in this binary.
+TEST_F(probe_test, parse)
+{
+    int number{};
+    std::string positional{};
+    auto parser = get_subcommand_parser({"-i", "3", "sub", "value"}, {"sub"});
+    parser.add_option(number, sharg::config{.short_id = 'i', .validator = sharg::arithmetic_range_validator{1, 5}});
+    EXPECT_NO_THROW(parser.parse());
+
+    auto & sub_parser = parser.get_sub_parser();
+    sub_parser.add_positional_option(positional, sharg::config{});
+    EXPECT_NO_THROW(sub_parser.parse());
+    EXPECT_EQ(positional, "value");
+}
+
+TEST_F(probe_test, readelf)
+{
+    std::string const notes = read_notes();
+
+    if (notes.empty())
+        GTEST_SKIP() << "readelf is not available.";
+
+#if SHARG_HAS_USDT
+    EXPECT_NE(notes.find("Provider: sharg"), std::string::npos) << notes;
+
+    for (std::string_view const probe : {"parse_start",
+                                         "parse_end",
+                                         "option_match",
+                                         "validator_entry",
+                                         "validator_exit",
+                                         "sub_parser_create",
+                                         "version_check_spawn"})
+    {
+        EXPECT_NE(notes.find("Name: " + std::string{probe} + "\n"), std::string::npos) << probe;
+    }
+#else
+    // The probes compile to nothing.
+    EXPECT_EQ(notes.find("Provider: sharg"), std::string::npos) << notes;
+#endif
+}
@@ -0,0 +1,176 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+// An interposer for the file system functions of the C library, to be loaded via LD_PRELOAD.
+// Each call is counted and forwarded to the C library. The count can be queried via `sharg_test_syscall_count`.
+// The system headers are not included on purpose: Their declarations differ in exception specifications and
+// attributes; the pointer arguments are only forwarded.
+
+#include <cstdarg>
+#include <cstddef>
+
+#include <dlfcn.h>
+
+namespace
+{
+
+size_t count{}; // Accessed atomically. <atomic> is not included because it declares `fopen` via <cstdio>.
+
+// Counts a call and returns the next definition of the function, i.e. the one of the C library.
+template <typename function_t>
+function_t * count_and_forward(char const * name)
+{
+    __atomic_fetch_add(&count, 1u, __ATOMIC_RELAXED);
+    return reinterpret_cast<function_t *>(dlsym(RTLD_NEXT, name));
+}
+
+} // namespace
+
+extern "C"
+{
+    size_t sharg_test_syscall_count()
+    {
+        return __atomic_load_n(&count, __ATOMIC_RELAXED);
+    }
+
+    void sharg_test_syscall_reset()
+    {
+        __atomic_store_n(&count, 0u, __ATOMIC_RELAXED);
+    }
+
+#define SHARG_FORWARD(name, signature, ...) return count_and_forward<signature>(#name)(__VA_ARGS__);
+
+    // Metadata and permissions
+    int stat(char const * path, void * buf)
+    {
+        SHARG_FORWARD(stat, int(char const *, void *), path, buf)
+    }
+    int stat64(char const * path, void * buf)
+    {
+        SHARG_FORWARD(stat64, int(char const *, void *), path, buf)
+    }
+    int lstat(char const * path, void * buf)
+    {
+        SHARG_FORWARD(lstat, int(char const *, void *), path, buf)
+    }
+    int lstat64(char const * path, void * buf)
+    {
+        SHARG_FORWARD(lstat64, int(char const *, void *), path, buf)
+    }
+    int fstatat(int dirfd, char const * path, void * buf, int flags)
+    {
+        SHARG_FORWARD(fstatat, int(int, char const *, void *, int), dirfd, path, buf, flags)
+    }
+    int fstatat64(int dirfd, char const * path, void * buf, int flags)
+    {
+        SHARG_FORWARD(fstatat64, int(int, char const *, void *, int), dirfd, path, buf, flags)
+    }
+    // Used instead of stat, lstat and fstatat by binaries built against glibc before 2.33.
+    int __xstat(int version, char const * path, void * buf)
+    {
+        SHARG_FORWARD(__xstat, int(int, char const *, void *), version, path, buf)
+    }
+    int __xstat64(int version, char const * path, void * buf)
+    {
+        SHARG_FORWARD(__xstat64, int(int, char const *, void *), version, path, buf)
+    }
+    int __lxstat(int version, char const * path, void * buf)
+    {
+        SHARG_FORWARD(__lxstat, int(int, char const *, void *), version, path, buf)
+    }
+    int __lxstat64(int version, char const * path, void * buf)
+    {
+        SHARG_FORWARD(__lxstat64, int(int, char const *, void *), version, path, buf)
+    }
+    int __fxstatat(int version, int dirfd, char const * path, void * buf, int flags)
+    {
+        SHARG_FORWARD(__fxstatat, int(int, int, char const *, void *, int), version, dirfd, path, buf, flags)
+    }
+    int __fxstatat64(int version, int dirfd, char const * path, void * buf, int flags)
+    {
+        SHARG_FORWARD(__fxstatat64, int(int, int, char const *, void *, int), version, dirfd, path, buf, flags)
+    }
+    int statx(int dirfd, char const * path, int flags, unsigned mask, void * buf)
+    {
+        SHARG_FORWARD(statx, int(int, char const *, int, unsigned, void *), dirfd, path, flags, mask, buf)
+    }
+    int access(char const * path, int mode)
+    {
+        SHARG_FORWARD(access, int(char const *, int), path, mode)
+    }
+    int faccessat(int dirfd, char const * path, int mode, int flags)
+    {
+        SHARG_FORWARD(faccessat, int(int, char const *, int, int), dirfd, path, mode, flags)
+    }
+
+    // Opening files and directories
+    int open(char const * path, int flags, ...)
+    {
+        va_list args;
+        va_start(args, flags);
+        unsigned const mode = va_arg(args, unsigned);
+        va_end(args);
+        SHARG_FORWARD(open, int(char const *, int, unsigned), path, flags, mode)
+    }
+    int open64(char const * path, int flags, ...)
+    {
+        va_list args;
+        va_start(args, flags);
+        unsigned const mode = va_arg(args, unsigned);
+        va_end(args);
+        SHARG_FORWARD(open64, int(char const *, int, unsigned), path, flags, mode)
+    }
+    int openat(int dirfd, char const * path, int flags, ...)
+    {
+        va_list args;
+        va_start(args, flags);
+        unsigned const mode = va_arg(args, unsigned);
+        va_end(args);
+        SHARG_FORWARD(openat, int(int, char const *, int, unsigned), dirfd, path, flags, mode)
+    }
+    int openat64(int dirfd, char const * path, int flags, ...)
+    {
+        va_list args;
+        va_start(args, flags);
+        unsigned const mode = va_arg(args, unsigned);
+        va_end(args);
+        SHARG_FORWARD(openat64, int(int, char const *, int, unsigned), dirfd, path, flags, mode)
+    }
+    void * fopen(char const * path, char const * mode)
+    {
+        SHARG_FORWARD(fopen, void *(char const *, char const *), path, mode)
+    }
+    void * fopen64(char const * path, char const * mode)
+    {
+        SHARG_FORWARD(fopen64, void *(char const *, char const *), path, mode)
+    }
+    void * opendir(char const * path)
+    {
+        SHARG_FORWARD(opendir, void *(char const *), path)
+    }
+
+    // Creating and removing entries
+    int mkdir(char const * path, unsigned mode)
+    {
+        SHARG_FORWARD(mkdir, int(char const *, unsigned), path, mode)
+    }
+    int unlink(char const * path)
+    {
+        SHARG_FORWARD(unlink, int(char const *), path)
+    }
+    int unlinkat(int dirfd, char const * path, int flags)
+    {
+        SHARG_FORWARD(unlinkat, int(int, char const *, int), dirfd, path, flags)
+    }
+    int rmdir(char const * path)
+    {
+        SHARG_FORWARD(rmdir, int(char const *), path)
+    }
+    int remove(char const * path)
+    {
+        SHARG_FORWARD(remove, int(char const *), path)
+    }
+
+#undef SHARG_FORWARD
+}
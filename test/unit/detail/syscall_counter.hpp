@@ -0,0 +1,35 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Access to the syscall_counter (see syscall_counter.cpp) from a test that is run with it preloaded.
+
+#pragma once
+
+#include <cstddef>
+
+#include <dlfcn.h>
+
+namespace sharg::test::syscall_counter
+{
+
+// The functions of the preloaded syscall_counter; nullptr if it is not preloaded.
+inline auto const count_calls = reinterpret_cast<size_t (*)()>(dlsym(RTLD_DEFAULT, "sharg_test_syscall_count"));
+inline auto const reset_calls = reinterpret_cast<void (*)()>(dlsym(RTLD_DEFAULT, "sharg_test_syscall_reset"));
+
+// Whether the syscall_counter is preloaded.
+inline bool is_loaded()
+{
+    return count_calls != nullptr && reset_calls != nullptr;
+}
+
+// Returns the number of file system calls made by `fn`. Requires the syscall_counter to be preloaded.
+template <typename fn_t>
+size_t file_system_calls(fn_t && fn)
+{
+    reset_calls();
+    fn();
+    return count_calls();
+}
+
+} // namespace sharg::test::syscall_counter
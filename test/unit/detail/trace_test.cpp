@@ -0,0 +1,129 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <sstream>
+
+#include <sharg/parser.hpp>
+#include <sharg/test/tmp_filename.hpp>
+
+// The recorder of the program reads SHARG_TRACE on first use, hence the variable is set before main.
+static std::filesystem::path const trace_file =
+    std::filesystem::temp_directory_path() / ("sharg_trace_test_" + std::to_string(getpid()) + ".json");
+[[maybe_unused]] static int const trace_enabled = setenv("SHARG_TRACE", trace_file.c_str(), 1);
+
+static std::string read_file(std::filesystem::path const & path)
+{
+    std::ifstream stream{path};
+    std::stringstream content{};
+    content << stream.rdbuf();
+    return content.str();
+}
+
+static size_t count_events(std::string const & json)
+{
+    size_t count{};
+
+    for (size_t position = json.find("\"ph\":\"X\""); position != std::string::npos;
+         position = json.find("\"ph\":\"X\"", position + 1u))
+        ++count;
+
+    return count;
+}
+
+TEST(trace_test, parser_phases)
+{
+    ASSERT_TRUE(sharg::detail::trace_recorder::instance().enabled());
+
+    int number{};
+    std::string name{};
+    std::string positional{};
+    sharg::parser parser{"test_parser",
+                         {"./test_parser", "-i", "3", "--name", "sharg", "value"},
+                         sharg::update_notifications::off};
+    parser.add_option(number, sharg::config{.short_id = 'i', .validator = sharg::arithmetic_range_validator{1, 5}});
+    parser.add_option(name, sharg::config{.long_id = "name"});
+    parser.add_positional_option(positional, sharg::config{});
+    EXPECT_NO_THROW(parser.parse());
+
+    sharg::detail::trace_recorder::instance().write();
+    std::string const json = read_file(trace_file);
+    std::filesystem::remove(trace_file);
+
+    EXPECT_TRUE(json.starts_with("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[")) << json;
+    EXPECT_TRUE(json.ends_with("]}\n")) << json;
+
+    for (std::string_view const phase : {"parser construction",
+                                         "verify_app_and_subcommand_names",
+                                         "expand_response_files",
+                                         "determine_format_and_subcommand",
+                                         "operations",
+#if !SHARG_DISABLE_VERSION_CHECK
+                                         "version check decision",
+#endif
+                                         "parse_format",
+                                         "positional option"})
+    {
+        EXPECT_NE(json.find("{\"name\":\"" + std::string{phase} + "\""), std::string::npos) << phase;
+    }
+
+    // Options and validators are labelled by the long identifier or, if there is none, the short identifier.
+    EXPECT_NE(json.find("\"option\",\"cat\":\"sharg\""), std::string::npos) << json;
+    EXPECT_NE(json.find("\"args\":{\"id\":\"i\"}"), std::string::npos) << json;
+    EXPECT_NE(json.find("\"args\":{\"id\":\"name\"}"), std::string::npos) << json;
+    // Validators of positional options are labelled by the position.
+    EXPECT_NE(json.find("\"args\":{\"id\":\"positional option 1\"}"), std::string::npos) << json;
+    EXPECT_EQ(count_events(json), 12u + !SHARG_DISABLE_VERSION_CHECK) << json;
+}
+
+TEST(trace_test, disabled)
+{
+    sharg::test::tmp_filename const file{"trace.json"};
+
+    {
+        sharg::detail::trace_recorder recorder{""};
+        EXPECT_FALSE(recorder.enabled());
+        EXPECT_EQ(recorder.now(), 0);
+        recorder.record("phase", "label", recorder.now());
+    }
+
+    sharg::detail::trace_recorder recorder{nullptr};
+    EXPECT_FALSE(recorder.enabled());
+    recorder.write();
+    EXPECT_FALSE(std::filesystem::exists(file.get_path()));
+}
+
+TEST(trace_test, labels)
+{
+    sharg::test::tmp_filename const file{"trace.json"};
+    std::string const long_label(100u, 'x');
+
+    {
+        sharg::detail::trace_recorder recorder{file.get_path().c_str()};
+        EXPECT_TRUE(recorder.enabled());
+        recorder.record("a\"b", "x\\y\n", recorder.now());
+        recorder.record("long", long_label, recorder.now());
+    } // written on destruction
+
+    std::string const json = read_file(file.get_path());
+    EXPECT_NE(json.find("\"name\":\"a\\\"b\""), std::string::npos) << json;
+    EXPECT_NE(json.find("\"id\":\"x\\\\y\\u000a\""), std::string::npos) << json;
+    EXPECT_NE(json.find("\"id\":\"" + long_label.substr(0u, sharg::detail::trace_recorder::label_capacity) + "\""),
+              std::string::npos)
+        << json;
+}
+
+TEST(trace_test, capacity)
+{
+    sharg::test::tmp_filename const file{"trace.json"};
+    sharg::detail::trace_recorder recorder{file.get_path().c_str()};
+
+    for (size_t i = 0; i < sharg::detail::trace_recorder::capacity + 10u; ++i)
+        recorder.record("phase", {}, recorder.now());
+
+    recorder.write();
+    EXPECT_EQ(count_events(read_file(file.get_path())), sharg::detail::trace_recorder::capacity);
+}
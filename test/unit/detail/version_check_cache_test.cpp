@@ -0,0 +1,180 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef _WIN32
+#    include <fcntl.h>
+#    include <unistd.h>
+
+#    include <sys/file.h>
+#endif
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include <sharg/detail/version_check_cache.hpp>
+#include <sharg/test/tmp_filename.hpp>
+
+TEST(version_check_cache_test, missing_file)
+{
+    sharg::test::tmp_filename const file{"version_check.cache"};
+    sharg::detail::version_check_cache const cache = sharg::detail::version_check_cache::read(file.get_path());
+
+    EXPECT_EQ(cache.last_download, 0);
+    EXPECT_TRUE(cache.entries.empty());
+    EXPECT_EQ(cache.find("app"), nullptr);
+}
+
+TEST(version_check_cache_test, round_trip)
+{
+    sharg::test::tmp_filename const file{"version_check.cache"};
+
+    EXPECT_TRUE(sharg::detail::version_check_cache::update(file.get_path(),
+                                                           [](sharg::detail::version_check_cache & cache)
+                                                           {
+                                                               cache.last_download = 1700000000;
+                                                               cache.get("app") = {.name = "app",
+                                                                                   .version = "1.2.3",
+                                                                                   .decision = "ALWAYS",
+                                                                                   .last_check = 1700000001,
+                                                                                   .latest_app_version = "2.0.0",
+                                                                                   .latest_sharg_version = "1.1.0"};
+                                                               cache.get("other_app").version = "0.1.0";
+                                                               return true;
+                                                           }));
+
+    sharg::detail::version_check_cache const cache = sharg::detail::version_check_cache::read(file.get_path());
+    EXPECT_EQ(cache.last_download, 1700000000);
+    ASSERT_EQ(cache.entries.size(), 2u);
+
+    sharg::detail::version_check_cache::entry const * app = cache.find("app");
+    ASSERT_NE(app, nullptr);
+    EXPECT_EQ(app->version, "1.2.3");
+    EXPECT_EQ(app->decision, "ALWAYS");
+    EXPECT_EQ(app->last_check, 1700000001);
+    EXPECT_EQ(app->latest_app_version, "2.0.0");
+    EXPECT_EQ(app->latest_sharg_version, "1.1.0");
+
+    sharg::detail::version_check_cache::entry const * other_app = cache.find("other_app");
+    ASSERT_NE(other_app, nullptr);
+    EXPECT_EQ(other_app->version, "0.1.0");
+    EXPECT_EQ(other_app->decision, "");
+    EXPECT_EQ(other_app->last_check, 0);
+
+    // The temporary file is renamed.
+    std::filesystem::path temporary = file.get_path();
+    temporary += ".tmp";
+    EXPECT_FALSE(std::filesystem::exists(temporary));
+
+    // Nothing is written if the update returns false.
+    EXPECT_TRUE(sharg::detail::version_check_cache::update(file.get_path(),
+                                                           [](sharg::detail::version_check_cache & cache)
+                                                           {
+                                                               cache.entries.clear();
+                                                               return false;
+                                                           }));
+    EXPECT_EQ(sharg::detail::version_check_cache::read(file.get_path()).entries.size(), 2u);
+}
+
+TEST(version_check_cache_test, malformed_lines)
+{
+    sharg::test::tmp_filename const file{"version_check.cache"};
+
+    std::ofstream{file.get_path()} << "sharg_version_check_cache 1\n"
+                                   << "last_download 42\n"
+                                   << "app\t1.0.0\tNEVER\t12\t-\t-\n"
+                                   << "too\tfew\tfields\n"
+                                   << "too\tmany\tfields\t1\t-\t-\t-\n"
+                                   << "bad/name\t1.0.0\tASK\t1\t-\t-\n"
+                                   << "bad_time\t1.0.0\tASK\tyesterday\t-\t-\n";
+
+    sharg::detail::version_check_cache const cache = sharg::detail::version_check_cache::read(file.get_path());
+    EXPECT_EQ(cache.last_download, 42);
+    ASSERT_EQ(cache.entries.size(), 1u);
+    EXPECT_EQ(cache.entries[0].name, "app");
+    EXPECT_EQ(cache.entries[0].decision, "NEVER");
+    EXPECT_EQ(cache.entries[0].last_check, 12);
+    EXPECT_EQ(cache.entries[0].latest_app_version, "");
+
+    // A file of another format is ignored.
+    std::ofstream{file.get_path()} << "1700000000\nALWAYS\n";
+    EXPECT_TRUE(sharg::detail::version_check_cache::read(file.get_path()).entries.empty());
+
+    // Fields with whitespace cannot be stored.
+    EXPECT_TRUE(sharg::detail::version_check_cache::is_field("1.0.0"));
+    EXPECT_FALSE(sharg::detail::version_check_cache::is_field(""));
+    EXPECT_FALSE(sharg::detail::version_check_cache::is_field("1.0 .0"));
+    EXPECT_FALSE(sharg::detail::version_check_cache::is_field("1.0\t.0"));
+}
+
+// Concurrent updates are serialised, hence exactly one of them claims the check.
+TEST(version_check_cache_test, concurrent_update)
+{
+    sharg::test::tmp_filename const file{"version_check.cache"};
+    std::atomic<size_t> claims{};
+    std::atomic<size_t> updates{};
+
+    {
+        std::vector<std::jthread> threads{};
+
+        for (size_t i = 0; i < 8u; ++i)
+        {
+            threads.emplace_back(
+                [&, i]()
+                {
+                    updates += sharg::detail::version_check_cache::update(
+                        file.get_path(),
+                        [&](sharg::detail::version_check_cache & cache)
+                        {
+                            cache.get("app_" + std::to_string(i));
+
+                            if (cache.last_download != 0)
+                                return true;
+
+                            cache.last_download = 1;
+                            ++claims;
+                            return true;
+                        });
+                });
+        }
+    }
+
+    EXPECT_EQ(claims.load(), 1u);
+    // An update is either skipped because the lock is busy, or not lost.
+    EXPECT_GE(updates.load(), 1u);
+    EXPECT_EQ(sharg::detail::version_check_cache::read(file.get_path()).entries.size(), updates.load());
+}
+
+#ifndef _WIN32
+// An update does not wait for a lock that is held by another process.
+TEST(version_check_cache_test, busy_lock)
+{
+    sharg::test::tmp_filename const file{"version_check.cache"};
+    std::filesystem::path const lock_file = sharg::detail::version_check_cache::lock_filename(file.get_path());
+
+    int const fd = ::open(lock_file.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    ASSERT_GE(fd, 0);
+    // A lock on a separate file description conflicts with the lock of the update, as a lock of another process.
+    ASSERT_EQ(::flock(fd, LOCK_EX), 0);
+
+    bool called{false};
+    auto const start = std::chrono::steady_clock::now();
+    bool const updated = sharg::detail::version_check_cache::update(file.get_path(),
+                                                                    [&](sharg::detail::version_check_cache &)
+                                                                    {
+                                                                        called = true;
+                                                                        return true;
+                                                                    });
+
+    EXPECT_FALSE(updated);
+    EXPECT_FALSE(called);
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds{5});
+    EXPECT_FALSE(std::filesystem::exists(file.get_path()));
+
+    ::close(fd);
+    std::filesystem::remove(lock_file);
+}
+#endif
@@ -0,0 +1,57 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#define SHARG_DISABLE_VERSION_CHECK 1 // test without update notifications
+
+#include <gtest/gtest.h>
+
+#include <sharg/parser.hpp>
+#include <sharg/test/test_fixture.hpp>
+#include <sharg/test/tmp_filename.hpp>
+
+class version_check_disabled_test : public sharg::test::test_fixture
+{
+protected:
+    void SetUp() override
+    {
+        // A home directory in which the version check would create its files.
+        setenv("HOME", home.get_path().parent_path().c_str(), 1);
+        unsetenv("SHARG_NO_VERSION_CHECK");
+    }
+
+    // The directory of the version check files.
+    std::filesystem::path cookie_directory() const
+    {
+        return home.get_path().parent_path() / ".config" / "seqan";
+    }
+
+    sharg::test::tmp_filename const home{"home"};
+};
+
+TEST_F(version_check_disabled_test, no_files)
+{
+    int option_value{};
+    sharg::parser parser{"test_parser", {"./test_parser", "-i", "3"}, sharg::update_notifications::on};
+    parser.add_option(option_value, sharg::config{.short_id = 'i'});
+
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_EQ(option_value, 3);
+    EXPECT_FALSE(std::filesystem::exists(cookie_directory()));
+}
+
+TEST_F(version_check_disabled_test, unknown_option)
+{
+    sharg::parser parser{"test_parser", {"./test_parser", "--version-check", "1"}, sharg::update_notifications::on};
+    EXPECT_THROW(parser.parse(), sharg::unknown_option);
+    EXPECT_FALSE(std::filesystem::exists(cookie_directory()));
+}
+
+TEST_F(version_check_disabled_test, help_page)
+{
+    sharg::parser parser{"test_parser", {"./test_parser", "-h"}, sharg::update_notifications::on};
+    std::string const help_page = get_parse_cout_on_exit(parser);
+
+    EXPECT_NE(help_page, "");
+    EXPECT_EQ(help_page.find("--version-check"), std::string::npos) << help_page;
+}
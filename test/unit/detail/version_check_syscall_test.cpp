@@ -0,0 +1,91 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <sharg/parser.hpp>
+#include <sharg/test/test_fixture.hpp>
+#include <sharg/test/tmp_filename.hpp>
+
+#include "syscall_counter.hpp"
+
+// The version check must not touch the file system if it is not going to be performed.
+class version_check_syscall_test : public sharg::test::test_fixture
+{
+protected:
+    void SetUp() override
+    {
+        if (!sharg::test::syscall_counter::is_loaded())
+            GTEST_SKIP() << "The syscall_counter is not preloaded.";
+
+        // A home directory in which the version check could create its files.
+        setenv(sharg::detail::version_checker::home_env_name, home.get_path().parent_path().c_str(), 1);
+        unsetenv("SHARG_NO_VERSION_CHECK");
+    }
+
+    void TearDown() override
+    {
+        unsetenv("SHARG_NO_VERSION_CHECK");
+    }
+
+    // Returns the number of file system calls made by constructing a parser with `arguments` and parsing.
+    static size_t parse_calls(std::vector<std::string> arguments, sharg::update_notifications const notifications)
+    {
+        return sharg::test::syscall_counter::file_system_calls(
+            [&]()
+            {
+                int option_value{};
+                sharg::parser parser{"test_parser", std::move(arguments), notifications};
+                parser.add_option(option_value, sharg::config{.short_id = 'i'});
+                EXPECT_NO_THROW(parser.parse());
+            });
+    }
+
+    sharg::test::tmp_filename const home{"home"};
+};
+
+TEST_F(version_check_syscall_test, developer_disabled)
+{
+    EXPECT_EQ(parse_calls({"test_parser", "-i", "3"}, sharg::update_notifications::off), 0u);
+    EXPECT_EQ(parse_calls({"test_parser", "-i", "3", "--version-check", "true"}, sharg::update_notifications::off),
+              0u);
+}
+
+TEST_F(version_check_syscall_test, environment_disabled)
+{
+    setenv("SHARG_NO_VERSION_CHECK", "1", 1);
+    EXPECT_EQ(parse_calls({"test_parser", "-i", "3"}, sharg::update_notifications::on), 0u);
+}
+
+TEST_F(version_check_syscall_test, user_disabled)
+{
+    EXPECT_EQ(parse_calls({"test_parser", "-i", "3", "--version-check", "false"}, sharg::update_notifications::on),
+              0u);
+}
+
+TEST_F(version_check_syscall_test, checker_construction)
+{
+    EXPECT_EQ(sharg::test::syscall_counter::file_system_calls(
+                  []()
+                  {
+                      sharg::detail::version_checker checker{"test_parser", "1.0.0"};
+                      EXPECT_FALSE(checker.decide_if_check_is_performed(sharg::update_notifications::off, true));
+                  }),
+              0u);
+
+    // Sanity check that the cookie path is determined on first use.
+    sharg::detail::version_checker checker{"test_parser", "1.0.0"};
+    EXPECT_GT(sharg::test::syscall_counter::file_system_calls(
+                  [&]()
+                  {
+                      EXPECT_FALSE(checker.cookie_path().empty());
+                  }),
+              0u);
+    EXPECT_EQ(sharg::test::syscall_counter::file_system_calls(
+                  [&]()
+                  {
+                      EXPECT_FALSE(checker.cookie_path().empty());
+                  }),
+              0u);
+}
@@ -7,6 +7,7 @@
 #include <thread>
 
 #include <sharg/parser.hpp>
+#include <sharg/test/http_server.hpp>
 #include <sharg/test/test_fixture.hpp>
 #include <sharg/test/tmp_filename.hpp>
 
@@ -70,7 +71,33 @@ protected:
 
     std::filesystem::path app_timestamp_filename() const
     {
-        return sharg::detail::version_checker{app_name, std::string{}}.timestamp_filename;
+        return sharg::detail::version_checker{app_name, std::string{}}.timestamp_filename();
+    }
+
+    std::filesystem::path cache_filename() const
+    {
+        return sharg::detail::version_checker{app_name, std::string{}}.cache_filename();
+    }
+
+    // Sets the decision and the time of the last check of the application in the cache.
+    void set_cache_entry(std::string const & decision, int64_t const last_check) const
+    {
+        sharg::detail::version_check_cache::update(cache_filename(),
+                                                   [&](sharg::detail::version_check_cache & cache)
+                                                   {
+                                                       auto & entry = cache.get(app_name);
+                                                       entry.decision = decision;
+                                                       entry.last_check = last_check;
+                                                       return true;
+                                                   });
+    }
+
+    // Returns the entry of the application in the cache or an empty entry.
+    sharg::detail::version_check_cache::entry cache_entry() const
+    {
+        sharg::detail::version_check_cache const cache = sharg::detail::version_check_cache::read(cache_filename());
+        auto const * entry = cache.find(app_name);
+        return entry ? *entry : sharg::detail::version_check_cache::entry{};
     }
 
     static auto current_unix_timestamp()
@@ -79,8 +106,6 @@ protected:
             .count();
     }
 
-    static inline std::regex const timestamp_regex{"^[[:digit:]]+$"}; // only digits
-
     template <typename... arg_ts>
     std::tuple<std::string, std::string, bool> simulate_parser(arg_ts &&... args)
     {
@@ -124,9 +149,12 @@ protected:
 
     bool remove_files_from_path() const
     {
+        std::error_code error{};
+        std::filesystem::remove(sharg::detail::version_check_cache::lock_filename(cache_filename()), error);
+
         return (!std::filesystem::exists(app_version_filename()) || std::filesystem::remove(app_version_filename()))
-            && (!std::filesystem::exists(app_timestamp_filename())
-                || std::filesystem::remove(app_timestamp_filename()));
+            && (!std::filesystem::exists(app_timestamp_filename()) || std::filesystem::remove(app_timestamp_filename()))
+            && (!std::filesystem::exists(cache_filename()) || std::filesystem::remove(cache_filename()));
     }
 
     template <typename message_type>
@@ -176,9 +204,14 @@ TEST_F(version_check_test, sanity_create_and_delete_files)
     EXPECT_TRUE(create_file(app_timestamp_filename(), current_unix_timestamp()));
     EXPECT_TRUE(std::filesystem::exists(app_timestamp_filename()));
 
+    set_cache_entry("ASK", current_unix_timestamp());
+    EXPECT_TRUE(std::filesystem::exists(cache_filename()));
+    EXPECT_EQ(cache_entry().decision, "ASK");
+
     EXPECT_TRUE(remove_files_from_path()); // clear files again
     EXPECT_FALSE(std::filesystem::exists(app_version_filename()));
     EXPECT_FALSE(std::filesystem::exists(app_timestamp_filename()));
+    EXPECT_FALSE(std::filesystem::exists(cache_filename()));
 }
 
 TEST_F(version_check_test, sanity_cookie)
@@ -239,9 +272,11 @@ TEST_F(version_check_test, option_implicitely_on)
     EXPECT_EQ(out, "");
     EXPECT_EQ(err, "");
 
-    // make sure that all files now exist
-    EXPECT_TRUE(std::filesystem::exists(app_timestamp_filename())) << app_timestamp_filename();
-    EXPECT_TRUE(std::regex_match(read_first_line(app_timestamp_filename()), timestamp_regex));
+    // make sure that the check of today was stored
+    EXPECT_TRUE(std::filesystem::exists(cache_filename())) << cache_filename();
+    EXPECT_EQ(cache_entry().decision, "ASK");
+    EXPECT_LE(current_unix_timestamp() - cache_entry().last_check, 1);
+    EXPECT_EQ(cache_entry().version, "2.3.4");
 
     EXPECT_FALSE(app_call_succeeded);
 
@@ -250,11 +285,11 @@ TEST_F(version_check_test, option_implicitely_on)
 
 TEST_F(version_check_test, time_out) // while implicitly on
 {
-    // create timestamp files
-    ASSERT_TRUE(create_file(app_timestamp_filename(), current_unix_timestamp()));
+    // check was performed today
+    set_cache_entry("ALWAYS", current_unix_timestamp());
 
     auto [out, err, app_call_succeeded] = simulate_parser("-f");
-    (void)app_call_succeeded;
+    EXPECT_FALSE(app_call_succeeded);
 
     EXPECT_EQ(out, "");
     EXPECT_EQ(err, "");
@@ -296,7 +331,7 @@ TEST_F(version_check_test, environment_variable_set)
     EXPECT_EQ(err, "");
 
     // if environment variable is set, no cookies are written
-    EXPECT_FALSE(std::filesystem::exists(app_timestamp_filename())) << app_timestamp_filename();
+    EXPECT_FALSE(std::filesystem::exists(cache_filename())) << cache_filename();
     EXPECT_FALSE(std::filesystem::exists(app_version_filename()));
 
     if (cached_env_var.empty())
@@ -317,7 +352,7 @@ TEST_F(version_check_test, option_off)
 
     // no timestamp is written since the decision was made explicitly
     EXPECT_FALSE(std::filesystem::exists(app_version_filename())) << app_version_filename();
-    EXPECT_FALSE(std::filesystem::exists(app_timestamp_filename())) << app_timestamp_filename();
+    EXPECT_FALSE(std::filesystem::exists(cache_filename())) << cache_filename();
 
     EXPECT_TRUE(remove_files_from_path()); // clear files again
 }
@@ -364,8 +399,8 @@ TEST_F(version_check_test, smaller_sharg_version)
     // create version file with euqal app version and a greater Sharg version than the current
     create_file(app_version_filename(), std::string{"2.3.4\n20.5.9"});
 
-    // create timestamp file that dates one day before current to trigger a message (one day = 86400 seconds)
-    ASSERT_TRUE(create_file(app_timestamp_filename(), current_unix_timestamp() - 100401));
+    // create cache entry that dates one day before current (one day = 86400 seconds)
+    set_cache_entry("ASK", current_unix_timestamp() - 100401);
 
     auto [out, err, app_call_succeeded] = simulate_parser(OPTION_VERSION_CHECK, OPTION_ON, "-f");
     (void)app_call_succeeded;
@@ -373,7 +408,9 @@ TEST_F(version_check_test, smaller_sharg_version)
     EXPECT_EQ(out, "");
     EXPECT_EQ(err, sharg::detail::version_checker::message_sharg_update);
 
-    EXPECT_TRUE(std::regex_match(read_first_line(app_timestamp_filename()), timestamp_regex));
+    // the response of the server is stored in the cache
+    EXPECT_EQ(cache_entry().latest_app_version, "2.3.4");
+    EXPECT_EQ(cache_entry().latest_sharg_version, "20.5.9");
 
     EXPECT_TRUE(remove_files_from_path()); // clear files again
 }
@@ -384,8 +421,8 @@ TEST_F(version_check_test, greater_app_version)
     // create version file with equal Sharg version and a smaller app version than the current
     ASSERT_TRUE(create_file(app_version_filename(), std::string{"1.5.9\n"} + sharg::sharg_version_cstring));
 
-    // create timestamp file that dates one day before current to trigger a message
-    ASSERT_TRUE(create_file(app_timestamp_filename(), current_unix_timestamp() - 100401)); // one day = 86400 seconds
+    // create cache entry that dates one day before current
+    set_cache_entry("ASK", current_unix_timestamp() - 100401); // one day = 86400 seconds
 
     auto [out, err, app_call_succeeded] = simulate_parser(OPTION_VERSION_CHECK, OPTION_ON, "-f");
     (void)app_call_succeeded;
@@ -393,7 +430,7 @@ TEST_F(version_check_test, greater_app_version)
     EXPECT_EQ(out, "");
     EXPECT_EQ(err, sharg::detail::version_checker::message_registered_app_update);
 
-    EXPECT_TRUE(std::regex_match(read_first_line(app_timestamp_filename()), timestamp_regex));
+    EXPECT_EQ(cache_entry().latest_app_version, "1.5.9");
 
     EXPECT_TRUE(remove_files_from_path()); // clear files again
 }
@@ -403,8 +440,8 @@ TEST_F(version_check_test, unregistered_app)
     // create version file with equal Sharg version and a smaller app version than the current
     ASSERT_TRUE(create_file(app_version_filename(), std::string{"UNREGISTERED_APP\n"} + sharg::sharg_version_cstring));
 
-    // create timestamp file that dates one day before current to trigger a message
-    ASSERT_TRUE(create_file(app_timestamp_filename(), current_unix_timestamp() - 100401)); // one day = 86400 seconds
+    // create cache entry that dates one day before current
+    set_cache_entry("ASK", current_unix_timestamp() - 100401); // one day = 86400 seconds
 
     auto [out, err, app_call_succeeded] = simulate_parser(OPTION_VERSION_CHECK, OPTION_ON, "-f");
     (void)app_call_succeeded;
@@ -412,7 +449,7 @@ TEST_F(version_check_test, unregistered_app)
     EXPECT_EQ(out, "");
     EXPECT_EQ(err, sharg::detail::version_checker::message_unregistered_app);
 
-    EXPECT_TRUE(std::regex_match(read_first_line(app_timestamp_filename()), timestamp_regex));
+    EXPECT_EQ(cache_entry().latest_app_version, "UNREGISTERED_APP");
 
     EXPECT_TRUE(remove_files_from_path()); // clear files again
 }
@@ -425,8 +462,8 @@ TEST_F(version_check_test, smaller_app_version)
     // create version file with equal Sharg version and a greater app version than the current
     ASSERT_TRUE(create_file(app_version_filename(), std::string{"20.5.9\n"} + sharg::sharg_version_cstring));
 
-    // create timestamp file that dates one day before current to trigger a message (one day = 86400 seconds)
-    ASSERT_TRUE(create_file(app_timestamp_filename(), current_unix_timestamp() - 100401));
+    // create cache entry that dates one day before current (one day = 86400 seconds)
+    set_cache_entry("ASK", current_unix_timestamp() - 100401);
 
     auto [out, err, app_call_succeeded] = simulate_parser(OPTION_VERSION_CHECK, OPTION_ON, "-f");
     (void)app_call_succeeded;
@@ -434,7 +471,7 @@ TEST_F(version_check_test, smaller_app_version)
     EXPECT_EQ(out, "");
     EXPECT_EQ(err, (sharg::detail::version_checker{app_name, "2.3.4"}.message_app_update));
 
-    EXPECT_TRUE(std::regex_match(read_first_line(app_timestamp_filename()), timestamp_regex));
+    EXPECT_EQ(cache_entry().latest_app_version, "20.5.9");
 
     EXPECT_TRUE(remove_files_from_path()); // clear files again
 }
@@ -452,8 +489,8 @@ TEST_F(version_check_test, smaller_app_version_custom_url)
     // create version file with equal Sharg version and a greater app version than the current
     ASSERT_TRUE(create_file(app_version_filename(), std::string{"20.5.9\n"} + sharg::sharg_version_cstring));
 
-    // create timestamp file that dates one day before current to trigger a message (one day = 86400 seconds)
-    ASSERT_TRUE(create_file(app_timestamp_filename(), current_unix_timestamp() - 100401));
+    // create cache entry that dates one day before current (one day = 86400 seconds)
+    set_cache_entry("ASK", current_unix_timestamp() - 100401);
 
     sharg::parser parser{app_name, {app_name, OPTION_VERSION_CHECK, OPTION_ON, "-f"}};
     parser.add_flag(dummy_flag, sharg::config{.short_id = 'f'});
@@ -473,7 +510,7 @@ TEST_F(version_check_test, smaller_app_version_custom_url)
     EXPECT_EQ(out, "");
     EXPECT_EQ(err, (sharg::detail::version_checker{app_name, parser.info.version, parser.info.url}.message_app_update));
 
-    EXPECT_TRUE(std::regex_match(read_first_line(app_timestamp_filename()), timestamp_regex));
+    EXPECT_EQ(cache_entry().latest_app_version, "20.5.9");
 
     if (!previous_value.empty())
         setenv("SHARG_NO_VERSION_CHECK", previous_value.c_str(), 1);
@@ -484,8 +521,7 @@ TEST_F(version_check_test, smaller_app_version_custom_url)
 
 TEST_F(version_check_test, user_specified_never)
 {
-    // create timestamp files
-    ASSERT_TRUE(create_file(app_timestamp_filename(), "NEVER"));
+    set_cache_entry("NEVER", 0);
 
     auto [out, err, app_call_succeeded] = simulate_parser("-f");
     (void)app_call_succeeded;
@@ -494,15 +530,15 @@ TEST_F(version_check_test, user_specified_never)
     EXPECT_EQ(err, "");
 
     EXPECT_FALSE(std::filesystem::exists(app_version_filename()));
-    EXPECT_EQ(read_first_line(app_timestamp_filename()), "NEVER"); // should not be modified
+    EXPECT_EQ(cache_entry().decision, "NEVER"); // should not be modified
+    EXPECT_EQ(cache_entry().last_check, 0);
 
     EXPECT_TRUE(remove_files_from_path()); // clear files again
 }
 
 TEST_F(version_check_test, user_specified_always)
 {
-    // create timestamp files
-    ASSERT_TRUE(create_file(app_timestamp_filename(), "ALWAYS"));
+    set_cache_entry("ALWAYS", 0);
 
     auto [out, err, app_call_succeeded] = simulate_parser("-f");
 
@@ -518,8 +554,8 @@ TEST_F(version_check_test, user_specified_always)
         std::cout << "App call did not succeed (server offline?) and could thus not be tested.\n";
     }
 
-    EXPECT_EQ(read_first_line(app_timestamp_filename()), "ALWAYS"); // should not be modified
-    EXPECT_TRUE(remove_files_from_path());                          // clear files again
+    EXPECT_EQ(cache_entry().decision, "ALWAYS"); // should not be modified
+    EXPECT_LE(current_unix_timestamp() - cache_entry().last_check, 1);
 
     EXPECT_TRUE(remove_files_from_path()); // clear files again
 }
@@ -528,7 +564,7 @@ TEST_F(version_check_test, wrong_version_string)
 {
     // create a corrupted version file. Nothing should be printed, it is just ignored
     ASSERT_TRUE(create_file(app_version_filename(), std::string{"20.wrong.9\nalso.wrong.4"}));
-    ASSERT_TRUE(create_file(app_timestamp_filename(), "ALWAYS"));
+    set_cache_entry("ALWAYS", 0);
 
     auto [out, err, app_call_succeeded] = simulate_parser("-f");
     (void)app_call_succeeded;
@@ -538,3 +574,241 @@ TEST_F(version_check_test, wrong_version_string)
 
     EXPECT_TRUE(remove_files_from_path()); // clear files again
 }
+
+// The server call is made without a shell and stores the response of the server in the version file.
+TEST_F(version_check_test, local_server)
+{
+    if (sharg::detail::find_program("wget").empty() && sharg::detail::find_program("curl").empty())
+        GTEST_SKIP() << "Neither wget nor curl is available.";
+
+    sharg::test::http_server const server{"20.5.9\n1.0.0\n"};
+    sharg::detail::version_checker checker{app_name, "2.3.4"};
+    checker.server_url = server.url();
+
+    std::promise<bool> prom{};
+    std::future<bool> future = prom.get_future();
+    checker(std::move(prom));
+
+    EXPECT_TRUE(future.get());
+    EXPECT_EQ(server.request_count(), 1u);
+    EXPECT_TRUE(server.last_path().starts_with("/SeqAn-Sharg_")) << server.last_path();
+    EXPECT_TRUE(server.last_path().ends_with("_" + app_name + "_2.3.4")) << server.last_path();
+    EXPECT_EQ(read_first_line(app_version_filename()), "20.5.9");
+
+    EXPECT_TRUE(remove_files_from_path()); // clear files again
+}
+
+// The parser does not wait for the version check on destruction.
+TEST_F(version_check_test, exit_does_not_wait)
+{
+    // A download program that takes longer than the test may take.
+    sharg::test::tmp_filename const bin{"bin"};
+    std::filesystem::create_directory(bin.get_path());
+    std::filesystem::path const wget = bin.get_path() / "wget";
+    std::ofstream{wget} << "#!/bin/sh\nsleep 10\n";
+    std::filesystem::permissions(wget, std::filesystem::perms::owner_all);
+
+    char const * const path_variable = std::getenv("PATH");
+    std::string const cached_path = path_variable ? path_variable : "";
+    std::string const cached_env_var = []()
+    {
+        std::string result{};
+        if (char * env = std::getenv("SHARG_NO_VERSION_CHECK"))
+        {
+            result = env;
+            unsetenv("SHARG_NO_VERSION_CHECK");
+        }
+        return result;
+    }();
+    setenv("PATH", bin.get_path().c_str(), 1);
+
+    auto const start = std::chrono::steady_clock::now();
+    {
+        bool dummy_flag{false};
+        sharg::parser parser{app_name,
+                             {app_name, OPTION_VERSION_CHECK, OPTION_ON, "-f"},
+                             sharg::update_notifications::on};
+        parser.info.version = "2.3.4";
+        parser.add_flag(dummy_flag, sharg::config{.short_id = 'f'});
+        EXPECT_NO_THROW(parser.parse());
+        EXPECT_TRUE(sharg::detail::test_accessor::version_check_future(parser).valid()); // The check was started.
+    }
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds{2});
+
+    setenv("PATH", cached_path.c_str(), 1);
+    if (!cached_env_var.empty())
+        setenv("SHARG_NO_VERSION_CHECK", cached_env_var.c_str(), 1);
+
+    EXPECT_TRUE(remove_files_from_path()); // clear files again
+}
+
+// The download program inherits the environment, e.g. the proxy settings.
+TEST_F(version_check_test, environment_is_passed)
+{
+    // A download program that only succeeds if it receives the proxy of the user.
+    sharg::test::tmp_filename const bin{"bin"};
+    std::filesystem::create_directory(bin.get_path());
+    std::filesystem::path const wget = bin.get_path() / "wget";
+    std::ofstream{wget} << "#!/bin/sh\n[ \"$https_proxy\" = \"http://proxy.example:3128\" ]\n";
+    std::filesystem::permissions(wget, std::filesystem::perms::owner_all);
+
+    char const * const path_variable = std::getenv("PATH");
+    std::string const cached_path = path_variable ? path_variable : "";
+    char const * const proxy_variable = std::getenv("https_proxy");
+    std::string const cached_proxy = proxy_variable ? proxy_variable : "";
+    setenv("PATH", bin.get_path().c_str(), 1);
+    setenv("https_proxy", "http://proxy.example:3128", 1);
+
+    sharg::detail::version_checker checker{app_name, "2.3.4"};
+    std::promise<bool> prom{};
+    std::future<bool> future = prom.get_future();
+    checker(std::move(prom));
+    bool const succeeded = future.get();
+
+    setenv("PATH", cached_path.c_str(), 1);
+    if (proxy_variable)
+        setenv("https_proxy", cached_proxy.c_str(), 1);
+    else
+        unsetenv("https_proxy");
+
+    EXPECT_TRUE(succeeded);
+    EXPECT_TRUE(remove_files_from_path()); // clear files again
+}
+
+// The decision of previous Sharg versions is kept.
+TEST_F(version_check_test, legacy_timestamp_file)
+{
+    ASSERT_TRUE(create_file(app_timestamp_filename(), "0\nNEVER"));
+
+    auto [out, err, app_call_succeeded] = simulate_parser("-f");
+
+    EXPECT_EQ(out, "");
+    EXPECT_EQ(err, "");
+    EXPECT_FALSE(app_call_succeeded);
+    EXPECT_FALSE(std::filesystem::exists(app_version_filename()));
+    EXPECT_FALSE(std::filesystem::exists(cache_filename()));
+
+    EXPECT_TRUE(remove_files_from_path()); // clear files again
+}
+
+// The version check of one application calls the server for all applications that always check once a day.
+TEST_F(version_check_test, check_all_applications)
+{
+    if (sharg::detail::find_program("wget").empty() && sharg::detail::find_program("curl").empty())
+        GTEST_SKIP() << "Neither wget nor curl is available.";
+
+    std::string const other_name = "test_version_check_other";
+    std::filesystem::path const other_version_filename = app_tmp_path() / (other_name + ".version");
+    int64_t const two_days_ago = current_unix_timestamp() - 2 * 86400;
+    sharg::detail::version_check_cache::update(cache_filename(),
+                                               [&](sharg::detail::version_check_cache & cache)
+                                               {
+                                                   cache.entries.push_back({.name = other_name,
+                                                                            .version = "1.0.0",
+                                                                            .decision = "ALWAYS",
+                                                                            .last_check = two_days_ago});
+                                                   // Applications whose user did not allow the check are skipped.
+                                                   cache.entries.push_back({.name = "test_version_check_ask",
+                                                                            .version = "1.0.0",
+                                                                            .decision = "ASK",
+                                                                            .last_check = two_days_ago});
+                                                   // Applications that did not run for a long time are skipped.
+                                                   cache.entries.push_back({.name = "test_version_check_stale",
+                                                                            .version = "1.0.0",
+                                                                            .decision = "ALWAYS",
+                                                                            .last_check = 0});
+                                                   return true;
+                                               });
+
+    sharg::test::http_server const server{"20.5.9\n1.0.0\n"};
+
+    auto run_checker = [&]()
+    {
+        sharg::detail::version_checker checker{app_name, "2.3.4"};
+        checker.server_url = server.url();
+
+        std::promise<bool> prom{};
+        std::future<bool> future = prom.get_future();
+        checker(std::move(prom));
+        return future.get();
+    };
+
+    auto wait_for_requests = [&](size_t const count)
+    {
+        for (size_t i = 0; i < 200u && server.request_count() < count; ++i)
+            std::this_thread::sleep_for(std::chrono::milliseconds{10});
+        return server.request_count();
+    };
+
+    EXPECT_TRUE(run_checker());
+    EXPECT_EQ(wait_for_requests(2u), 2u);
+    for (size_t i = 0; i < 200u && read_first_line(other_version_filename).empty(); ++i)
+        std::this_thread::sleep_for(std::chrono::milliseconds{10});
+    EXPECT_EQ(read_first_line(other_version_filename), "20.5.9");
+
+    // The response for the other application is stored in the cache by the next version check.
+    // The server is only called for this application, because all applications were checked today.
+    EXPECT_TRUE(run_checker());
+    EXPECT_EQ(wait_for_requests(3u), 3u);
+    std::this_thread::sleep_for(std::chrono::milliseconds{50});
+    EXPECT_EQ(server.request_count(), 3u);
+
+    sharg::detail::version_check_cache const cache = sharg::detail::version_check_cache::read(cache_filename());
+    ASSERT_NE(cache.find(other_name), nullptr);
+    EXPECT_EQ(cache.find(other_name)->latest_app_version, "20.5.9");
+    EXPECT_FALSE(std::filesystem::exists(other_version_filename));
+
+    EXPECT_TRUE(remove_files_from_path()); // clear files again
+}
+
+// The version check of one application calls the server for a limited number of other applications.
+TEST_F(version_check_test, check_all_applications_limit)
+{
+    if (sharg::detail::find_program("wget").empty() && sharg::detail::find_program("curl").empty())
+        GTEST_SKIP() << "Neither wget nor curl is available.";
+
+    std::vector<std::string> other_names{};
+    for (size_t i = 0; i < 6u; ++i)
+        other_names.push_back("test_version_check_other_" + std::to_string(i));
+
+    int64_t const two_days_ago = current_unix_timestamp() - 2 * 86400;
+    sharg::detail::version_check_cache::update(cache_filename(),
+                                               [&](sharg::detail::version_check_cache & cache)
+                                               {
+                                                   for (size_t i = 0; i < other_names.size(); ++i)
+                                                       cache.entries.push_back(
+                                                           {.name = other_names[i],
+                                                            .version = "1.0.0",
+                                                            .decision = "ALWAYS",
+                                                            .last_check = two_days_ago - static_cast<int64_t>(i)});
+                                                   return true;
+                                               });
+
+    sharg::test::http_server const server{"20.5.9\n1.0.0\n"};
+    sharg::detail::version_checker checker{app_name, "2.3.4"};
+    checker.server_url = server.url();
+
+    std::promise<bool> prom{};
+    std::future<bool> future = prom.get_future();
+    checker(std::move(prom));
+    EXPECT_TRUE(future.get());
+
+    // This application and the four applications that ran most recently.
+    for (size_t i = 0; i < 200u && server.request_count() < 5u; ++i)
+        std::this_thread::sleep_for(std::chrono::milliseconds{10});
+    std::this_thread::sleep_for(std::chrono::milliseconds{50});
+    EXPECT_EQ(server.request_count(), 5u);
+
+    for (size_t i = 0; i < other_names.size(); ++i)
+    {
+        std::filesystem::path const version_filename = app_tmp_path() / (other_names[i] + ".version");
+        for (size_t j = 0; i < 4u && j < 200u && read_first_line(version_filename).empty(); ++j)
+            std::this_thread::sleep_for(std::chrono::milliseconds{10});
+        EXPECT_EQ(std::filesystem::exists(version_filename), i < 4u) << other_names[i];
+
+        std::error_code error{};
+        std::filesystem::remove(version_filename, error);
+    }
+
+    EXPECT_TRUE(remove_files_from_path()); // clear files again
+}
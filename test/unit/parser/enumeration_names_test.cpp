@@ -25,6 +25,18 @@ auto enumeration_names(bar)
     return std::unordered_map<std::string_view, bar>{{"one", bar::one}, {"two", bar::two}, {"three", bar::three}};
 }
 
+enum class baz : uint8_t
+{
+    one,
+    two
+};
+
+// The documented std::string keyed form has no heterogeneous lookup.
+auto enumeration_names(baz)
+{
+    return std::unordered_map<std::string, baz>{{"one", baz::one}, {"two", baz::two}};
+}
+
 } // namespace foo
 
 namespace Other
@@ -38,6 +50,37 @@ enum class bar : uint8_t
 
 } // namespace Other
 
+namespace table
+{
+
+enum class colour : int8_t
+{
+    red = -1,
+    green,
+    blue
+};
+
+constexpr auto enumeration_names(colour)
+{
+    return sharg::enumeration_table<colour, 4>{
+        {{"red", colour::red}, {"blue", colour::blue}, {"r", colour::red}, {"green", colour::green}}};
+}
+
+enum class sparse : uint32_t
+{
+    small = 1,
+    medium = 1000,
+    large = 1'000'000
+};
+
+constexpr auto enumeration_names(sparse)
+{
+    return sharg::enumeration_table<sparse, 3>{
+        {{"large", sparse::large}, {"medium", sparse::medium}, {"small", sparse::small}}};
+}
+
+} // namespace table
+
 namespace sharg::custom
 {
 
@@ -128,6 +171,26 @@ TEST_F(enumeration_names_test, enum_error_message)
                      "You have chosen an invalid input value: nine. Please use one of: [1, one, 2, two]");
 }
 
+TEST_F(enumeration_names_test, string_keys)
+{
+    foo::baz value{};
+
+    auto parser = get_parser("-e", "two");
+    parser.add_option(value, sharg::config{.short_id = 'e'});
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_TRUE(value == foo::baz::two);
+
+    parser = get_parser("-e", "nine");
+    parser.add_option(value, sharg::config{.short_id = 'e'});
+    EXPECT_THROW_MSG(parser.parse(),
+                     sharg::user_input_error,
+                     "You have chosen an invalid input value: nine. Please use one of: [one, two]");
+
+    std::ostringstream stream{};
+    stream << foo::baz::one;
+    EXPECT_EQ(stream.str(), "one");
+}
+
 // https://github.com/seqan/seqan3/pull/2381
 TEST_F(enumeration_names_test, container_options)
 {
@@ -138,3 +201,62 @@ TEST_F(enumeration_names_test, container_options)
     EXPECT_NO_THROW(parser.parse());
     EXPECT_TRUE(option_values == (std::vector<foo::bar>{foo::bar::two, foo::bar::one, foo::bar::three}));
 }
+
+TEST_F(enumeration_names_test, enumeration_table)
+{
+    // The table is a constant expression.
+    static constexpr auto names = sharg::detail::adl_only::enumeration_names_cpo<table::colour>{}();
+    static_assert(names.size() == 4u);
+    static_assert(names.find("r")->second == table::colour::red);
+    static_assert(names.find("yellow") == names.end());
+    static_assert(names.find_value(table::colour::red)->first == "red");
+
+    // Ordered by value and, for equal values, by the given order.
+    std::vector<std::string_view> const keys{std::ranges::begin(names | std::views::keys),
+                                             std::ranges::end(names | std::views::keys)};
+    EXPECT_EQ(keys, (std::vector<std::string_view>{"red", "r", "green", "blue"}));
+
+    for (auto const & [key, value] : names)
+        EXPECT_EQ(names.find(key)->second, value);
+
+    EXPECT_FALSE(names.contains(""));
+    EXPECT_FALSE(names.contains("re"));
+    EXPECT_EQ(names.find_value(static_cast<table::colour>(2)), names.end());
+    EXPECT_EQ(names.find_value(static_cast<table::colour>(-2)), names.end());
+
+    auto const & sparse_names = sharg::enumeration_names<table::sparse>;
+    EXPECT_EQ(sparse_names.find("medium")->second, table::sparse::medium);
+    EXPECT_EQ(sparse_names.find_value(table::sparse::large)->first, "large");
+    EXPECT_EQ(sparse_names.find_value(static_cast<table::sparse>(2)), sparse_names.end());
+    EXPECT_EQ(sparse_names.begin()->second, table::sparse::small);
+
+    // Names must be unique.
+    using table_t = sharg::enumeration_table<int, 3>;
+    EXPECT_THROW((table_t{{{"one", 1}, {"two", 2}, {"one", 3}}}), sharg::design_error);
+    EXPECT_NO_THROW((table_t{{{"one", 1}, {"two", 2}, {"1", 1}}}));
+}
+
+TEST_F(enumeration_names_test, enumeration_table_parse)
+{
+    table::colour value{};
+    std::vector<table::colour> values{};
+
+    auto parser = get_parser("-c", "r", "-l", "blue", "-l", "green");
+    parser.add_option(value, sharg::config{.short_id = 'c'});
+    parser.add_option(values, sharg::config{.short_id = 'l'});
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_EQ(value, table::colour::red);
+    EXPECT_EQ(values, (std::vector<table::colour>{table::colour::blue, table::colour::green}));
+
+    // The names are listed in the order of the table, i.e. the names of a value in the order they were given.
+    parser = get_parser("-c", "yellow");
+    parser.add_option(value, sharg::config{.short_id = 'c'});
+    EXPECT_THROW_MSG(parser.parse(),
+                     sharg::user_input_error,
+                     "You have chosen an invalid input value: yellow. Please use one of: [red, r, green, blue]");
+
+    std::ostringstream stream{};
+    stream << table::colour::red << ' ' << table::colour::blue << ' ' << static_cast<table::colour>(5) << ' '
+           << table::sparse::medium;
+    EXPECT_EQ(stream.str(), "red blue <UNKNOWN_VALUE> medium");
+}
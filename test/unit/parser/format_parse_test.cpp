@@ -93,6 +93,84 @@ TEST_F(format_parse_test, add_flag_short_id_multiple)
     EXPECT_EQ(option_value4, true);
 }
 
+TEST_F(format_parse_test, add_flag_short_id_cluster_with_option)
+{
+    bool flag_value_v{false};
+    bool flag_value_q{false};
+    int option_value{};
+
+    auto check = [&](auto... arguments)
+    {
+        flag_value_v = false;
+        flag_value_q = false;
+        option_value = 0;
+
+        auto parser = get_parser(arguments...);
+        parser.add_flag(flag_value_v, sharg::config{.short_id = 'v'});
+        parser.add_flag(flag_value_q, sharg::config{.short_id = 'q'});
+        parser.add_option(option_value, sharg::config{.short_id = 't'});
+        EXPECT_NO_THROW(parser.parse());
+    };
+
+    // option value attached to the cluster
+    check("-vt4");
+    EXPECT_TRUE(flag_value_v);
+    EXPECT_FALSE(flag_value_q);
+    EXPECT_EQ(option_value, 4);
+
+    // option value attached to the cluster by =
+    check("-qvt=4");
+    EXPECT_TRUE(flag_value_v);
+    EXPECT_TRUE(flag_value_q);
+    EXPECT_EQ(option_value, 4);
+
+    // option value as next argument
+    check("-vt", "4");
+    EXPECT_TRUE(flag_value_v);
+    EXPECT_EQ(option_value, 4);
+
+    // characters after the option are its value, not flags
+    {
+        flag_value_v = false;
+        flag_value_q = false;
+        std::string string_value{};
+        auto parser = get_parser("-vtq");
+        parser.add_flag(flag_value_v, sharg::config{.short_id = 'v'});
+        parser.add_flag(flag_value_q, sharg::config{.short_id = 'q'});
+        parser.add_option(string_value, sharg::config{.short_id = 't'});
+        EXPECT_NO_THROW(parser.parse());
+        EXPECT_EQ(string_value, "q");
+        EXPECT_FALSE(flag_value_q);
+    }
+
+    // missing value at the end of the command line
+    {
+        flag_value_v = false;
+        auto parser = get_parser("-vt");
+        parser.add_flag(flag_value_v, sharg::config{.short_id = 'v'});
+        parser.add_option(option_value, sharg::config{.short_id = 't'});
+        EXPECT_THROW_MSG(parser.parse(), sharg::too_few_arguments, "Missing value for option -t");
+    }
+
+    // unknown flag in front of the option
+    {
+        flag_value_v = false;
+        auto parser = get_parser("-vxt4");
+        parser.add_flag(flag_value_v, sharg::config{.short_id = 'v'});
+        parser.add_option(option_value, sharg::config{.short_id = 't'});
+        EXPECT_THROW(parser.parse(), sharg::unknown_option);
+    }
+
+    // flag specified twice in a cluster
+    {
+        flag_value_v = false;
+        auto parser = get_parser("-vvt4");
+        parser.add_flag(flag_value_v, sharg::config{.short_id = 'v'});
+        parser.add_option(option_value, sharg::config{.short_id = 't'});
+        EXPECT_THROW(parser.parse(), sharg::unknown_option);
+    }
+}
+
 TEST_F(format_parse_test, add_flag_long_id)
 {
     bool option_value1{false};
@@ -117,6 +195,87 @@ TEST_F(format_parse_test, add_positional_option)
     EXPECT_EQ(positional_value, "positional_string");
 }
 
+TEST_F(format_parse_test, add_positional_option_sink)
+{
+    int option_value{};
+    std::vector<int> values{};
+
+    // callable
+    auto parser = get_parser("1", "-i", "4", "2", "3");
+    parser.add_option(option_value, sharg::config{.short_id = 'i'});
+    parser.add_positional_option_sink<int>(
+        [&](int const value)
+        {
+            EXPECT_EQ(option_value, 4); // options are parsed before the positional options
+            values.push_back(value);
+        },
+        sharg::config{});
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_EQ(values, (std::vector<int>{1, 2, 3}));
+
+    // output iterator, after another positional option
+    std::string positional_value{};
+    std::vector<std::string> strings{};
+    parser = get_parser("first", "second", "third");
+    parser.add_positional_option(positional_value, sharg::config{});
+    parser.add_positional_option_sink<std::string>(std::back_inserter(strings), sharg::config{});
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_EQ(positional_value, "first");
+    EXPECT_EQ(strings, (std::vector<std::string>{"second", "third"}));
+}
+
+TEST_F(format_parse_test, add_positional_option_sink_error)
+{
+    std::vector<int> values{};
+    auto sink = std::back_inserter(values);
+
+    // each value is validated before it is passed to the sink
+    auto parser = get_parser("1", "2", "20", "3");
+    parser.add_positional_option_sink<int>(sink, sharg::config{.validator = sharg::arithmetic_range_validator{0, 10}});
+    EXPECT_THROW_MSG(parser.parse(),
+                     sharg::validation_error,
+                     "Validation failed for positional option 3: Value 20 is not in range [0,10].");
+    EXPECT_EQ(values, (std::vector<int>{1, 2}));
+
+    values.clear();
+    parser = get_parser("1", "two", "3");
+    parser.add_positional_option_sink<int>(sink, sharg::config{});
+    EXPECT_THROW_MSG(parser.parse(),
+                     sharg::user_input_error,
+                     "Value parse failed for positional option2: Argument two could not be parsed as type signed 32 "
+                     "bit integer.");
+    EXPECT_EQ(values, (std::vector<int>{1}));
+
+    std::string positional_value{};
+    parser = get_parser("first");
+    parser.add_positional_option(positional_value, sharg::config{});
+    parser.add_positional_option_sink<int>(sink, sharg::config{});
+    EXPECT_THROW_MSG(parser.parse(),
+                     sharg::too_few_arguments,
+                     "Not enough positional arguments provided (Need at least 2). See -h/--help for more information.");
+
+    // the sink takes all remaining arguments, like a list option
+    parser = get_parser("1");
+    parser.add_positional_option_sink<int>(sink, sharg::config{});
+    EXPECT_THROW(parser.add_positional_option(positional_value, sharg::config{}), sharg::design_error);
+    EXPECT_THROW(parser.add_positional_option_sink<int>(sink, sharg::config{}), sharg::design_error);
+}
+
+TEST_F(format_parse_test, add_positional_option_sink_help_page)
+{
+    std::vector<int> values{};
+    sharg::config const config{.description = "Some values.", .validator = sharg::arithmetic_range_validator{0, 10}};
+
+    // the help page shows the sink like a positional list option
+    auto parser = get_parser("-h");
+    parser.add_positional_option_sink<int>(std::back_inserter(values), config);
+    std::string const sink_help = get_parse_cout_on_exit(parser);
+
+    parser = get_parser("-h");
+    parser.add_positional_option(values, config);
+    EXPECT_EQ(sink_help, get_parse_cout_on_exit(parser));
+}
+
 TEST_F(format_parse_test, independent_add_order)
 {
     // testing same command line input different add_* order
@@ -444,6 +603,140 @@ TEST_F(format_parse_test, parse_error_double_option)
     EXPECT_FLOAT_EQ(option_value, 12.457); // Todo: Expected?
 }
 
+TEST_F(format_parse_test, parse_success_path_option)
+{
+    std::filesystem::path option_value{};
+
+    // The argument is taken as is; operator>> would stop at the space and remove quotes.
+    auto parser = get_parser("-p", "my file.txt");
+    parser.add_option(option_value, sharg::config{.short_id = 'p'});
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_EQ(option_value, std::filesystem::path{"my file.txt"});
+
+    parser = get_parser("-p", "\"quoted\"");
+    parser.add_option(option_value, sharg::config{.short_id = 'p'});
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_EQ(option_value, std::filesystem::path{"\"quoted\""});
+}
+
+TEST_F(format_parse_test, parse_duration_option)
+{
+    using namespace std::chrono_literals;
+
+    auto parse = [this]<typename duration_t>(duration_t & option_value, char const * value)
+    {
+        auto parser = get_parser("-d", value);
+        parser.add_option(option_value, sharg::config{.short_id = 'd'});
+        parser.parse();
+    };
+
+    std::chrono::milliseconds milliseconds{};
+    parse(milliseconds, "250");
+    EXPECT_EQ(milliseconds, 250ms);
+    parse(milliseconds, "2s");
+    EXPECT_EQ(milliseconds, 2000ms);
+    parse(milliseconds, "-1min");
+    EXPECT_EQ(milliseconds, -60000ms);
+    parse(milliseconds, "3000us");
+    EXPECT_EQ(milliseconds, 3ms);
+
+    std::chrono::duration<double> seconds{};
+    parse(seconds, "1500ms");
+    EXPECT_DOUBLE_EQ(seconds.count(), 1.5);
+    parse(seconds, "0.5h");
+    EXPECT_DOUBLE_EQ(seconds.count(), 1800.0);
+
+    EXPECT_THROW(parse(milliseconds, "1500us"), sharg::user_input_error); // not a whole number of milliseconds
+    EXPECT_THROW(parse(milliseconds, "2 s"), sharg::user_input_error);
+    EXPECT_THROW(parse(milliseconds, "2sec"), sharg::user_input_error);
+    EXPECT_THROW(parse(milliseconds, "s"), sharg::user_input_error);
+    EXPECT_THROW(parse(milliseconds, "1.5s"), sharg::user_input_error);
+
+    std::chrono::duration<int8_t> small{};
+    parse(small, "2min");
+    EXPECT_EQ(small.count(), 120);
+    EXPECT_THROW_MSG(parse(small, "3min"),
+                     sharg::user_input_error,
+                     "Value parse failed for -d: Argument 3min is not in the valid range of type "
+                         + sharg::detail::type_name_as_string<std::chrono::duration<int8_t>> + ".");
+    EXPECT_THROW(parse(small, "1000"), sharg::user_input_error);
+}
+
+namespace
+{
+
+// Parsed via sharg::custom::parsing<from_chars_type>::from_chars; operator>> must not be used.
+struct from_chars_type
+{
+    int value{};
+    bool used_stream{false};
+
+    friend std::istream & operator>>(std::istream & stream, from_chars_type & v)
+    {
+        v.used_stream = true;
+        return stream >> v.value;
+    }
+
+    friend std::ostream & operator<<(std::ostream & stream, from_chars_type const & v)
+    {
+        return stream << v.value;
+    }
+};
+
+} // namespace
+
+namespace sharg::custom
+{
+
+template <>
+struct parsing<from_chars_type>
+{
+    static std::errc from_chars(std::string_view const in, from_chars_type & v)
+    {
+        if (in == "big")
+            return std::errc::result_out_of_range;
+        if (in.size() != 1u || in[0] < 'a' || in[0] > 'z')
+            return std::errc::invalid_argument;
+
+        v.value = in[0] - 'a';
+        return std::errc{};
+    }
+};
+
+} // namespace sharg::custom
+
+TEST_F(format_parse_test, parse_custom_from_chars_option)
+{
+    static_assert(sharg::parsable<from_chars_type>);
+
+    from_chars_type option_value{};
+    std::vector<from_chars_type> positional_values{};
+
+    auto parser = get_parser("-c", "c", "a", "z");
+    parser.add_option(option_value, sharg::config{.short_id = 'c'});
+    parser.add_positional_option(positional_values, sharg::config{});
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_EQ(option_value.value, 2);
+    EXPECT_FALSE(option_value.used_stream);
+    ASSERT_EQ(positional_values.size(), 2u);
+    EXPECT_EQ(positional_values[0].value, 0);
+    EXPECT_EQ(positional_values[1].value, 25);
+
+    parser = get_parser("-c", "1");
+    parser.add_option(option_value, sharg::config{.short_id = 'c'});
+    EXPECT_THROW_MSG(parser.parse(),
+                     sharg::user_input_error,
+                     "Value parse failed for -c: Argument 1 could not be parsed as type "
+                         + sharg::detail::type_name_as_string<from_chars_type> + ".");
+
+    parser = get_parser("-c", "big");
+    parser.add_option(option_value, sharg::config{.short_id = 'c'});
+    EXPECT_THROW_MSG(parser.parse(),
+                     sharg::user_input_error,
+                     "Value parse failed for -c: Argument big is not in the valid range of type "
+                         + sharg::detail::type_name_as_string<from_chars_type> + ".");
+}
+
 TEST_F(format_parse_test, too_many_arguments_error)
 {
     int option_value{};
@@ -595,6 +888,34 @@ TEST_F(format_parse_test, argv_const_combinations)
     char const * const argv_const12[] = {arg1, arg2};
     parser = sharg::parser{"test_parser", 2, argv_const12, sharg::update_notifications::off};
     check_and_reset();
+
+    // borrowed
+    parser = sharg::parser{sharg::borrow_arguments, "test_parser", 2, argv_const12, sharg::update_notifications::off};
+    check_and_reset();
+}
+
+TEST_F(format_parse_test, argv_outlived_by_parser)
+{
+    int option_value{};
+
+    // The argc/argv constructor copies the arguments, i.e. argv does not need to outlive the parser.
+    auto make_parser = []()
+    {
+        std::vector<std::string> arguments{"./parser", "-i", "42"};
+        std::vector<char const *> argv{};
+        for (std::string const & argument : arguments)
+            argv.push_back(argument.c_str());
+
+        return std::make_unique<sharg::parser>("test_parser",
+                                               static_cast<int>(argv.size()),
+                                               argv.data(),
+                                               sharg::update_notifications::off);
+    };
+
+    auto parser = make_parser();
+    parser->add_option(option_value, sharg::config{.short_id = 'i'});
+    EXPECT_NO_THROW(parser->parse());
+    EXPECT_EQ(option_value, 42);
 }
 
 TEST_F(format_parse_test, multiple_empty_options)
@@ -769,6 +1090,74 @@ TEST_F(format_parse_test, is_option_set)
     EXPECT_THROW(parser.is_option_set('\0'), sharg::design_error);
 }
 
+TEST_F(format_parse_test, option_positions)
+{
+    std::vector<int> list{};
+    std::string value{};
+    bool flag_a{};
+    bool flag_b{};
+    bool flag_c{};
+    std::vector<std::string> positional_options{};
+
+    // 0 is the executable
+    auto parser = get_parser("-i", "1", "-ab", "--list=2", "-s", "-c", "-i3", "--", "-c", "--list");
+    parser.add_option(list, sharg::config{.short_id = 'i', .long_id = "list"});
+    parser.add_option(value, sharg::config{.short_id = 's'});
+    parser.add_flag(flag_a, sharg::config{.short_id = 'a'});
+    parser.add_flag(flag_b, sharg::config{.short_id = 'b', .long_id = "bflag"});
+    parser.add_flag(flag_c, sharg::config{.short_id = 'c'});
+    parser.add_positional_option(positional_options, sharg::config{});
+
+    EXPECT_THROW(parser.option_positions('i'), sharg::design_error); // parse() was not called
+
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_EQ(list, (std::vector<int>{1, 2, 3}));
+    EXPECT_EQ(value, "-c"); // -c is the value of -s
+    EXPECT_TRUE(flag_a);
+    EXPECT_TRUE(flag_b);
+    EXPECT_FALSE(flag_c);
+    EXPECT_EQ(positional_options, (std::vector<std::string>{"-c", "--list"}));
+
+    auto positions = [&parser](auto const id)
+    {
+        std::span<size_t const> const result = parser.option_positions(id);
+        return std::vector<size_t>(result.begin(), result.end());
+    };
+
+    EXPECT_EQ(positions('i'), (std::vector<size_t>{1u, 4u, 7u}));
+    EXPECT_EQ(positions("list"), (std::vector<size_t>{1u, 4u, 7u}));
+    EXPECT_EQ(positions('s'), (std::vector<size_t>{5u}));
+    EXPECT_EQ(positions('a'), (std::vector<size_t>{3u}));
+    EXPECT_EQ(positions("bflag"), (std::vector<size_t>{3u}));
+    EXPECT_EQ(positions('c'), (std::vector<size_t>{}));
+    EXPECT_FALSE(parser.is_option_set('c'));
+
+    // Special options are never set.
+    EXPECT_EQ(positions("help"), (std::vector<size_t>{}));
+    EXPECT_THROW(parser.option_positions("foo"), sharg::design_error);
+    EXPECT_THROW(parser.option_positions("i"), sharg::design_error);
+}
+
+TEST_F(format_parse_test, option_positions_subcommand)
+{
+    int top_value{};
+    int sub_value{};
+
+    auto top_level_parser = get_subcommand_parser({"-t", "1", "sub", "-x", "5"}, {"sub"});
+    top_level_parser.add_option(top_value, sharg::config{.short_id = 't'});
+    EXPECT_NO_THROW(top_level_parser.parse());
+    EXPECT_EQ(top_level_parser.option_positions('t').size(), 1u);
+    EXPECT_EQ(top_level_parser.option_positions('t')[0], 1u);
+
+    // The positions of the sub-parser are relative to the subcommand.
+    auto & sub_parser = top_level_parser.get_sub_parser();
+    sub_parser.add_option(sub_value, sharg::config{.short_id = 'x'});
+    EXPECT_NO_THROW(sub_parser.parse());
+    EXPECT_EQ(sub_value, 5);
+    EXPECT_EQ(sub_parser.option_positions('x').size(), 1u);
+    EXPECT_EQ(sub_parser.option_positions('x')[0], 1u);
+}
+
 // https://github.com/seqan/seqan3/issues/2835
 TEST_F(format_parse_test, error_message_parsing)
 {
@@ -797,6 +1186,70 @@ TEST_F(format_parse_test, container_options)
     parser.add_option(bool_options, sharg::config{.short_id = 'b'});
     EXPECT_NO_THROW(parser.parse());
     EXPECT_TRUE(bool_options == (std::vector<bool>{true, false, true}));
+
+    // values given by short and long identifier keep their order
+    integer_options.clear();
+    parser = get_parser("-i", "2", "--int", "1", "-i3", "--int=4");
+    parser.add_option(integer_options, sharg::config{.short_id = 'i', .long_id = "int"});
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_TRUE(integer_options == (std::vector<int>{2, 1, 3, 4}));
+}
+
+TEST_F(format_parse_test, list_delimiter)
+{
+    std::vector<int> integer_options{};
+    std::vector<std::string> string_options{};
+
+    auto parser = get_parser("-i", "2,1", "--int", "3", "-i4,5,6", "--int=7,8");
+    parser.add_option(integer_options, sharg::config{.short_id = 'i', .long_id = "int", .list_delimiter = ','});
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_EQ(integer_options, (std::vector<int>{2, 1, 3, 4, 5, 6, 7, 8}));
+
+    // A list longer than the block compared at once, with delimiters at the block boundaries.
+    std::string list{};
+    std::vector<int> expected{};
+    for (int i = 0; i < 100; ++i)
+    {
+        list += std::to_string(i) + ',';
+        expected.push_back(i);
+    }
+    list.pop_back();
+
+    integer_options.clear();
+    parser = get_parser("-i", list.c_str());
+    parser.add_option(integer_options, sharg::config{.short_id = 'i', .list_delimiter = ','});
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_EQ(integer_options, expected);
+
+    // Empty values are kept for strings.
+    parser = get_parser("-s", ";a;;bc;", "-s", "");
+    parser.add_option(string_options, sharg::config{.short_id = 's', .list_delimiter = ';'});
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_EQ(string_options, (std::vector<std::string>{"", "a", "", "bc", "", ""}));
+
+    // Without a delimiter, values are not split.
+    string_options.clear();
+    parser = get_parser("-s", "a,b");
+    parser.add_option(string_options, sharg::config{.short_id = 's'});
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_EQ(string_options, (std::vector<std::string>{"a,b"}));
+
+    parser = get_parser("-i", "1,,2");
+    parser.add_option(integer_options, sharg::config{.short_id = 'i', .list_delimiter = ','});
+    EXPECT_THROW_MSG(parser.parse(),
+                     sharg::user_input_error,
+                     "Value parse failed for -i: Argument  could not be parsed as type signed 32 bit integer.");
+
+    parser = get_parser("--int", "1,99999999999");
+    parser.add_option(integer_options, sharg::config{.long_id = "int", .list_delimiter = ','});
+    EXPECT_THROW_MSG(parser.parse(),
+                     sharg::user_input_error,
+                     "Value parse failed for --int: Numeric argument 99999999999 is not in the valid range "
+                     "[-2147483648,2147483647].");
+
+    parser = get_parser("--int=");
+    parser.add_option(integer_options, sharg::config{.long_id = "int", .list_delimiter = ','});
+    EXPECT_THROW_MSG(parser.parse(), sharg::too_few_arguments, "Missing value for option --int");
 }
 
 // https://github.com/seqan/seqan3/issues/2393
@@ -7,6 +7,7 @@
 #include <ranges>
 
 #include <sharg/parser.hpp>
+#include <sharg/test/expect_throw_msg.hpp>
 #include <sharg/test/file_access.hpp>
 #include <sharg/test/test_fixture.hpp>
 #include <sharg/test/tmp_filename.hpp>
@@ -174,9 +175,9 @@ TEST_F(validator_test, output_file)
 
     // file does exist but allow to overwrite it
     my_validator = sharg::output_file_validator{options::open_or_create, formats};
-    EXPECT_TRUE(std::filesystem::exists(existing_path)); // Todo: Expected?
+    EXPECT_TRUE(std::filesystem::exists(existing_path));
     EXPECT_NO_THROW(my_validator(existing_path));
-    EXPECT_FALSE(std::filesystem::exists(existing_path)); // Todo: Expected?
+    EXPECT_TRUE(std::filesystem::exists(existing_path)); // The existing file is neither truncated nor removed.
 
     // file has no extension.
     std::filesystem::path test_path = not_existing_path;
@@ -925,6 +926,28 @@ TEST_F(validator_test, regex_validator_error)
     EXPECT_EQ(vector[1], "tt");
 }
 
+TEST_F(validator_test, regex_validator_engines)
+{
+    // Matched by the automaton and by std::regex, respectively.
+    for (std::string const pattern : {"^chr[0-9XYM]{1,2}$", "chr([0-9]{1,2}|X|Y|M)"})
+    {
+        sharg::regex_validator const validator{pattern};
+        sharg::regex_validator const copy{validator};
+
+        EXPECT_NO_THROW(validator("chr1"));
+        EXPECT_NO_THROW(copy(std::vector<std::string>{"chr1", "chr22", "chrX"}));
+        EXPECT_THROW_MSG(copy(std::vector<std::string>{"chr1", "chr100", "chrUn"}),
+                         sharg::validation_error,
+                         "Value chr100 did not match the pattern " + pattern + ".");
+    }
+
+    // An invalid pattern is reported when parsing.
+    std::string value{};
+    auto parser = get_parser("chr1");
+    EXPECT_NO_THROW(parser.add_positional_option(value, sharg::config{.validator = sharg::regex_validator{"chr("}}));
+    EXPECT_THROW(parser.parse(), sharg::validation_error);
+}
+
 TEST_F(validator_test, chaining_validators_common_type)
 {
     // chaining integral options stay integral
@@ -1110,3 +1133,53 @@ TEST_F(validator_test, chaining_validators)
     EXPECT_EQ(option_vector.size(), 1u);
     EXPECT_EQ(option_vector[0], tmp_string);
 }
+
+TEST_F(validator_test, parallel_validation)
+{
+    sharg::test::tmp_filename const tmp_name{"testbox.fasta"};
+    sharg::test::tmp_filename const missing_name{"missing.fasta"};
+    sharg::test::tmp_filename const other_missing_name{"other_missing.fasta"};
+    std::string const tmp_string{tmp_name.get_path().string()};
+    std::string const missing_string{missing_name.get_path().string()};
+    std::ofstream{tmp_name.get_path()};
+
+    std::vector<std::filesystem::path> option_values{};
+    std::vector<std::filesystem::path> positional_values{};
+    sharg::config const config{.short_id = 'i',
+                               .validator = sharg::input_file_validator{{"fasta"}},
+                               .parallel_validation = true};
+    sharg::config const positional_config{.validator = sharg::input_file_validator{{"fasta"}},
+                                          .parallel_validation = true};
+
+    std::vector<std::string> arguments{"./test_parser"};
+    for (size_t i = 0; i < 100u; ++i)
+        arguments.insert(arguments.end(), {"-i", tmp_string, tmp_string});
+
+    auto parser = sharg::parser{"test_parser", arguments, sharg::update_notifications::off};
+    parser.add_option(option_values, config);
+    parser.add_positional_option(positional_values, positional_config);
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_EQ(option_values.size(), 100u);
+    EXPECT_EQ(positional_values.size(), 100u);
+
+    // The first invalid value is reported.
+    arguments[3 * 50 + 2] = missing_string;
+    arguments[3 * 70 + 2] = other_missing_name.get_path().string();
+    parser = sharg::parser{"test_parser", arguments, sharg::update_notifications::off};
+    parser.add_option(option_values, config);
+    parser.add_positional_option(positional_values, positional_config);
+    EXPECT_THROW_MSG(parser.parse(),
+                     sharg::validation_error,
+                     "Validation failed for option -i: The file \"" + missing_string + "\" does not exist!");
+
+    arguments[3 * 50 + 2] = tmp_string;
+    arguments[3 * 70 + 2] = tmp_string;
+    arguments[3 * 50 + 3] = missing_string;
+    parser = sharg::parser{"test_parser", arguments, sharg::update_notifications::off};
+    parser.add_option(option_values, config);
+    parser.add_positional_option(positional_values, positional_config);
+    EXPECT_THROW_MSG(parser.parse(),
+                     sharg::validation_error,
+                     "Validation failed for positional option 101: The file \"" + missing_string
+                         + "\" does not exist!");
+}
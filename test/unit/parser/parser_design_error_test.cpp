@@ -231,6 +231,41 @@ TEST_F(verify_default_message_config_test, flag_set)
                  sharg::design_error);
 }
 
+// -----------------------------------------------------------------------------
+// list_delimiter config verification
+// -----------------------------------------------------------------------------
+
+class verify_list_delimiter_config_test : public sharg::test::test_fixture
+{};
+
+TEST_F(verify_list_delimiter_config_test, option_set)
+{
+    int option_value{};
+    std::vector<int> list_value{};
+
+    auto parser = get_parser();
+    EXPECT_THROW(parser.add_option(option_value, sharg::config{.short_id = 'i', .list_delimiter = ','}),
+                 sharg::design_error);
+    EXPECT_NO_THROW(parser.add_option(list_value, sharg::config{.short_id = 'l', .list_delimiter = ','}));
+}
+
+TEST_F(verify_list_delimiter_config_test, positional_option_set)
+{
+    std::vector<int> option_value{};
+
+    auto parser = get_parser("arg1");
+    EXPECT_THROW(parser.add_positional_option(option_value, sharg::config{.list_delimiter = ','}),
+                 sharg::design_error);
+}
+
+TEST_F(verify_list_delimiter_config_test, flag_set)
+{
+    bool value{};
+
+    auto parser = get_parser();
+    EXPECT_THROW(parser.add_flag(value, sharg::config{.short_id = 'i', .list_delimiter = ','}), sharg::design_error);
+}
+
 // -----------------------------------------------------------------------------
 // general
 // -----------------------------------------------------------------------------
@@ -0,0 +1,263 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+
+#include <sharg/parser.hpp>
+#include <sharg/test/expect_throw_msg.hpp>
+#include <sharg/test/test_fixture.hpp>
+#include <sharg/test/tmp_filename.hpp>
+
+class response_file_test : public sharg::test::test_fixture
+{
+protected:
+    // Writes `contents` to the temporary file and returns the argument referring to it, i.e. "@<path>".
+    static std::string write(sharg::test::tmp_filename const & file, std::string_view const contents)
+    {
+        std::ofstream{file.get_path(), std::ios::binary} << contents;
+        return "@" + file.get_path().string();
+    }
+
+    sharg::test::tmp_filename file{"args.txt"};
+    sharg::test::tmp_filename nested_file{"nested.txt"};
+};
+
+TEST_F(response_file_test, off_by_default)
+{
+    std::string positional_value{};
+
+    auto parser = get_parser(write(file, "-i\n5\n"));
+    parser.add_positional_option(positional_value, sharg::config{});
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_EQ(positional_value, "@" + file.get_path().string());
+}
+
+TEST_F(response_file_test, newline)
+{
+    int option_value{};
+    std::vector<std::string> positional_values{};
+
+    auto parser = get_parser("-i", "3", write(file, "first file.fa\r\n\nsecond file.fa\n"), "third.fa");
+    parser.set_response_file_mode(sharg::response_file_mode::newline);
+    parser.add_option(option_value, sharg::config{.short_id = 'i'});
+    parser.add_positional_option(positional_values, sharg::config{});
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_EQ(option_value, 3);
+    EXPECT_EQ(positional_values, (std::vector<std::string>{"first file.fa", "second file.fa", "third.fa"}));
+}
+
+TEST_F(response_file_test, null)
+{
+    int option_value{};
+    std::vector<std::string> positional_values{};
+
+    using namespace std::string_view_literals;
+    auto parser = get_parser(write(file, "-i\0" "5\0a b\nc\0\0d"sv));
+    parser.set_response_file_mode(sharg::response_file_mode::null);
+    parser.add_option(option_value, sharg::config{.short_id = 'i'});
+    parser.add_positional_option(positional_values, sharg::config{});
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_EQ(option_value, 5);
+    EXPECT_EQ(positional_values, (std::vector<std::string>{"a b\nc", "d"}));
+}
+
+TEST_F(response_file_test, shell)
+{
+    std::vector<std::string> option_values{};
+
+    auto parser = get_parser(write(file,
+                                   "-s plain -s 'single quoted \\ \"' -s \"double \\\"quoted\\\" \\a\"\n"
+                                   "-s escaped\\ space -s mi'x'\"ed\" -s con\\\ntinued -s=attached\t'' \\\n"
+                                   "  -s after_continuation"));
+    parser.set_response_file_mode(sharg::response_file_mode::shell);
+    parser.add_option(option_values, sharg::config{.short_id = 's'});
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_EQ(option_values,
+              (std::vector<std::string>{"plain",
+                                        "single quoted \\ \"",
+                                        "double \"quoted\" \\a",
+                                        "escaped space",
+                                        "mixed",
+                                        "continued",
+                                        "attached",
+                                        "after_continuation"}));
+
+    // A line continuation between arguments is whitespace, while '' is an empty argument.
+    auto tokenize = [](std::string_view const contents)
+    {
+        std::deque<std::string> rewritten{};
+        sharg::detail::response_file_tokenizer tokenizer{contents, sharg::response_file_mode::shell, rewritten, "file"};
+        std::vector<std::string> arguments{};
+
+        while (std::optional<std::string_view> argument = tokenizer.next())
+            arguments.emplace_back(*argument);
+
+        return arguments;
+    };
+
+    EXPECT_EQ(tokenize("a \\\n b"), (std::vector<std::string>{"a", "b"}));
+    EXPECT_EQ(tokenize("-i 3 \\\n  -o x \\\n"), (std::vector<std::string>{"-i", "3", "-o", "x"}));
+    EXPECT_EQ(tokenize("a '' b"), (std::vector<std::string>{"a", "", "b"}));
+}
+
+TEST_F(response_file_test, shell_unterminated_quote)
+{
+    std::string positional_value{};
+
+    for (std::string_view const contents : {"'unterminated", "\"unterminated", "\"escaped quote\\\""})
+    {
+        auto parser = get_parser(write(file, contents));
+        parser.set_response_file_mode(sharg::response_file_mode::shell);
+        parser.add_positional_option(positional_value, sharg::config{});
+        EXPECT_THROW_MSG(parser.parse(),
+                         sharg::user_input_error,
+                         "Unterminated quote in the response file " + file.get_path().string() + ".");
+    }
+}
+
+TEST_F(response_file_test, nested)
+{
+    std::vector<std::string> positional_values{};
+
+    write(nested_file, "b\nc\n");
+    auto parser = get_parser(write(file, "a\n@" + nested_file.get_path().string() + "\nd\n"), "e");
+    parser.set_response_file_mode(sharg::response_file_mode::newline);
+    parser.add_positional_option(positional_values, sharg::config{});
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_EQ(positional_values, (std::vector<std::string>{"a", "b", "c", "d", "e"}));
+}
+
+TEST_F(response_file_test, same_file_twice)
+{
+    std::vector<std::string> positional_values{};
+
+    std::string const argument = write(file, "a\n");
+    auto parser = get_parser(argument, argument);
+    parser.set_response_file_mode(sharg::response_file_mode::newline);
+    parser.add_positional_option(positional_values, sharg::config{});
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_EQ(positional_values, (std::vector<std::string>{"a", "a"}));
+}
+
+TEST_F(response_file_test, cycle)
+{
+    std::vector<std::string> positional_values{};
+
+    write(nested_file, "b\n@" + file.get_path().string() + "\n");
+    auto parser = get_parser(write(file, "a\n@" + nested_file.get_path().string() + "\n"));
+    parser.set_response_file_mode(sharg::response_file_mode::newline);
+    parser.add_positional_option(positional_values, sharg::config{});
+    EXPECT_THROW_MSG(parser.parse(),
+                     sharg::user_input_error,
+                     "The response file " + file.get_path().string() + " includes itself.");
+}
+
+TEST_F(response_file_test, missing_file)
+{
+    std::string positional_value{};
+
+    auto parser = get_parser("@" + file.get_path().string());
+    parser.set_response_file_mode(sharg::response_file_mode::newline);
+    parser.add_positional_option(positional_value, sharg::config{});
+    EXPECT_THROW_MSG(parser.parse(),
+                     sharg::user_input_error,
+                     "Could not open the response file " + file.get_path().string() + ".");
+
+    parser = get_parser("@" + file.get_path().parent_path().string());
+    parser.set_response_file_mode(sharg::response_file_mode::newline);
+    parser.add_positional_option(positional_value, sharg::config{});
+    EXPECT_THROW(parser.parse(), sharg::user_input_error);
+}
+
+TEST_F(response_file_test, empty_file)
+{
+    std::vector<std::string> positional_values{};
+
+    auto parser = get_parser(write(file, ""), "a");
+    parser.set_response_file_mode(sharg::response_file_mode::shell);
+    parser.add_positional_option(positional_values, sharg::config{});
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_EQ(positional_values, (std::vector<std::string>{"a"}));
+}
+
+TEST_F(response_file_test, end_of_options)
+{
+    bool flag_value{false};
+    std::vector<std::string> positional_values{};
+
+    // `--` on the command line
+    std::string const argument = write(file, "-f\n");
+    auto parser = get_parser("--", argument);
+    parser.set_response_file_mode(sharg::response_file_mode::newline);
+    parser.add_flag(flag_value, sharg::config{.short_id = 'f'});
+    parser.add_positional_option(positional_values, sharg::config{});
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_FALSE(flag_value);
+    EXPECT_EQ(positional_values, (std::vector<std::string>{argument}));
+
+    // `--` in the response file
+    write(nested_file, "-f\n");
+    std::string const nested_argument = "@" + nested_file.get_path().string();
+    parser = get_parser(write(file, "-f\n--\n-g\n" + nested_argument + "\n"), nested_argument);
+    parser.set_response_file_mode(sharg::response_file_mode::newline);
+    parser.add_flag(flag_value, sharg::config{.short_id = 'f'});
+    parser.add_positional_option(positional_values, sharg::config{});
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_TRUE(flag_value);
+    EXPECT_EQ(positional_values, (std::vector<std::string>{"-g", nested_argument, nested_argument}));
+}
+
+TEST_F(response_file_test, special_format)
+{
+    auto parser = get_parser(write(file, "--version\n"));
+    parser.set_response_file_mode(sharg::response_file_mode::newline);
+    EXPECT_EQ(get_parse_cout_on_exit(parser), "test_parser\n===========\n\n" + version_str());
+}
+
+TEST_F(response_file_test, subcommand)
+{
+    for (auto [mode, contents] : {std::pair{sharg::response_file_mode::newline, "build\n-i\n5\n"},
+                                  std::pair{sharg::response_file_mode::shell, "build -i 5"}})
+    {
+        int option_value{};
+
+        auto parser = get_subcommand_parser({write(file, contents)}, {"build"});
+        parser.set_response_file_mode(mode);
+        EXPECT_NO_THROW(parser.parse());
+
+        sharg::parser & sub_parser = parser.get_sub_parser();
+        EXPECT_EQ(sub_parser.info.app_name, "test_parser-build");
+
+        sub_parser.add_option(option_value, sharg::config{.short_id = 'i'});
+        EXPECT_NO_THROW(sub_parser.parse());
+        EXPECT_EQ(option_value, 5);
+    }
+}
+
+TEST_F(response_file_test, arguments_refer_to_file)
+{
+    std::string positional_value{};
+
+    auto parser = get_parser(write(file, "mapped"));
+    parser.set_response_file_mode(sharg::response_file_mode::newline);
+    parser.add_positional_option(positional_value, sharg::config{});
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_EQ(positional_value, "mapped");
+
+    std::span<std::string_view const> const arguments = sharg::detail::test_accessor::arguments(parser);
+    ASSERT_EQ(arguments.size(), 2u);
+    EXPECT_EQ(arguments[1], "mapped");
+}
+
+TEST_F(response_file_test, set_after_parse)
+{
+    std::string positional_value{};
+
+    auto parser = get_parser("a");
+    parser.add_positional_option(positional_value, sharg::config{});
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_THROW(parser.set_response_file_mode(sharg::response_file_mode::shell), sharg::design_error);
+}
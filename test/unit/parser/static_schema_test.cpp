@@ -0,0 +1,256 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include <sharg/parser_schema.hpp>
+#include <sharg/static_schema.hpp>
+#include <sharg/test/expect_throw_msg.hpp>
+#include <sharg/validators.hpp>
+
+struct test_options
+{
+    int threads{1};
+    std::string name{"default"};
+    std::vector<int> numbers{};
+    bool verbose{false};
+    bool quiet{false};
+    std::string input{};
+    std::vector<std::string> files{};
+
+    bool operator==(test_options const &) const = default;
+};
+
+static auto make_schema()
+{
+    return sharg::static_schema{
+        sharg::static_option<'t', "threads">(&test_options::threads,
+                                             sharg::config{.validator = sharg::arithmetic_range_validator{1, 64}}),
+        sharg::static_option<"name">(&test_options::name),
+        sharg::static_option<'n'>(&test_options::numbers),
+        sharg::static_flag<'v'>(&test_options::verbose),
+        sharg::static_flag<'q', "quiet">(&test_options::quiet),
+        sharg::static_positional_option(&test_options::input),
+        sharg::static_positional_option(&test_options::files)};
+}
+
+// The same options as make_schema().
+static sharg::parser_schema<test_options> make_dynamic_schema()
+{
+    sharg::parser_schema<test_options> schema{};
+    schema.add_option(&test_options::threads,
+                      sharg::config{.short_id = 't',
+                                    .long_id = "threads",
+                                    .validator = sharg::arithmetic_range_validator{1, 64}});
+    schema.add_option(&test_options::name, sharg::config{.long_id = "name"});
+    schema.add_option(&test_options::numbers, sharg::config{.short_id = 'n'});
+    schema.add_flag(&test_options::verbose, sharg::config{.short_id = 'v'});
+    schema.add_flag(&test_options::quiet, sharg::config{.short_id = 'q', .long_id = "quiet"});
+    schema.add_positional_option(&test_options::input, sharg::config{});
+    schema.add_positional_option(&test_options::files, sharg::config{});
+    return schema;
+}
+
+template <typename schema_t>
+static test_options parse(schema_t const & schema, std::initializer_list<std::string_view> const arguments)
+{
+    std::vector<std::string_view> const args{arguments};
+    return schema.parse(args);
+}
+
+TEST(static_schema_test, parse)
+{
+    auto const schema = make_schema();
+
+    test_options const options = parse(schema, {"-t", "4", "-vn1", "--name=sharg", "-n", "2", "in", "a", "b"});
+    EXPECT_EQ(options.threads, 4);
+    EXPECT_EQ(options.name, "sharg");
+    EXPECT_EQ(options.numbers, (std::vector<int>{1, 2}));
+    EXPECT_TRUE(options.verbose);
+    EXPECT_FALSE(options.quiet);
+    EXPECT_EQ(options.input, "in");
+    EXPECT_EQ(options.files, (std::vector<std::string>{"a", "b"}));
+
+    // Each parse starts from test_options{}.
+    test_options const other = parse(schema, {"--quiet", "--", "-v", "-t"});
+    EXPECT_EQ(other.threads, 1);
+    EXPECT_EQ(other.name, "default");
+    EXPECT_TRUE(other.numbers.empty());
+    EXPECT_FALSE(other.verbose);
+    EXPECT_TRUE(other.quiet);
+    EXPECT_EQ(other.input, "-v");
+    EXPECT_EQ(other.files, (std::vector<std::string>{"-t"}));
+}
+
+TEST(static_schema_test, user_errors)
+{
+    auto const schema = make_schema();
+
+    EXPECT_THROW(parse(schema, {"-t", "100", "in"}), sharg::validation_error);
+    EXPECT_THROW(parse(schema, {"-t", "x", "in"}), sharg::user_input_error);
+    EXPECT_THROW(parse(schema, {"-t"}), sharg::too_few_arguments);
+    EXPECT_THROW(parse(schema, {"-t", "1", "--threads", "2", "in"}), sharg::option_declared_multiple_times);
+    EXPECT_THROW(parse(schema, {"-vv", "in"}), sharg::unknown_option);
+    EXPECT_THROW(parse(schema, {}), sharg::too_few_arguments);
+    EXPECT_THROW_MSG(parse(schema, {"--help"}),
+                     sharg::unknown_option,
+                     "Unknown option --help. In case this is meant to be a non-option/argument/parameter, please "
+                     "specify the start of non-options with '--'. See -h/--help for program information.");
+
+    // An error does not affect later parses.
+    EXPECT_EQ(parse(schema, {"-t", "2", "in", "a"}).threads, 2);
+}
+
+// Both schemas return the same options and throw the same errors.
+TEST(static_schema_test, same_as_parser_schema)
+{
+    auto const schema = make_schema();
+    auto const dynamic_schema = make_dynamic_schema();
+
+    std::vector<std::vector<std::string_view>> const command_lines{
+        {"in"},
+        {"in", "a", "b", "c"},
+        {"-t", "4", "-vn1", "--name=sharg", "-n", "2", "in", "a", "b"},
+        {"-qvt8", "in", "--threads", "9"},
+        {"-n", "3", "-n4", "-n=5", "--", "--name", "-q"},
+        {"--quiet=1", "in"},
+        {"-qq", "in"},
+        {"-x", "-y", "in"},
+        {"-xyz", "in"},
+        {"--threads", "in"},
+        {"-t=", "in"},
+        {"-t", "65", "in"},
+        {"-t", "4", "-t", "5", "in"},
+        {"-n", "x", "in"},
+        {"-n"},
+        {"--name"},
+        {},
+        {"", "in", ""},
+        {"-", "--", ""},
+    };
+
+    for (std::vector<std::string_view> const & command_line : command_lines)
+    {
+        std::string expected_error{};
+        std::string actual_error{};
+        test_options expected{};
+        test_options actual{};
+
+        try
+        {
+            expected = dynamic_schema.parse(command_line);
+        }
+        catch (sharg::parser_error const & ex)
+        {
+            expected_error = typeid(ex).name() + std::string{": "} + ex.what();
+        }
+
+        try
+        {
+            actual = schema.parse(command_line);
+        }
+        catch (sharg::parser_error const & ex)
+        {
+            actual_error = typeid(ex).name() + std::string{": "} + ex.what();
+        }
+
+        std::string const label = command_line.empty() ? std::string{"<empty>"} : std::string{command_line[0]};
+        EXPECT_EQ(actual_error, expected_error) << label;
+        EXPECT_TRUE(actual == expected) << label;
+    }
+}
+
+TEST(static_schema_test, required_option)
+{
+    sharg::static_schema const schema{
+        sharg::static_option<"name">(&test_options::name, sharg::config{.required = true})};
+
+    EXPECT_THROW(parse(schema, {}), sharg::required_option_missing);
+    EXPECT_EQ(parse(schema, {"--name", "x"}).name, "x");
+    EXPECT_THROW(parse(schema, {"--name", "x", "y"}), sharg::too_many_arguments);
+}
+
+TEST(static_schema_test, design_errors)
+{
+    EXPECT_THROW((sharg::static_schema{
+                     sharg::static_option<'t'>(&test_options::threads, sharg::config{.short_id = 't'})}),
+                 sharg::design_error);
+    EXPECT_THROW((sharg::static_schema{
+                     sharg::static_option<'t'>(&test_options::threads, sharg::config{.long_id = "threads"})}),
+                 sharg::design_error);
+    EXPECT_THROW((sharg::static_schema{sharg::static_option<'t'>(
+                     &test_options::threads,
+                     sharg::config{.default_message = "one", .required = true})}),
+                 sharg::design_error);
+    EXPECT_THROW((sharg::static_schema{
+                     sharg::static_flag<'v'>(&test_options::verbose, sharg::config{.default_message = "false"})}),
+                 sharg::design_error);
+    EXPECT_THROW((sharg::static_schema{
+                     sharg::static_positional_option(&test_options::input, sharg::config{.advanced = true})}),
+                 sharg::design_error);
+    EXPECT_THROW((sharg::static_schema{
+                     sharg::static_option<'t'>(&test_options::threads, sharg::config{.list_delimiter = ','})}),
+                 sharg::design_error);
+
+    struct flag_options
+    {
+        bool flag{true};
+    };
+
+    EXPECT_THROW((sharg::static_schema{sharg::static_flag<'f'>(&flag_options::flag)}), sharg::design_error);
+}
+
+TEST(static_schema_test, list_delimiter)
+{
+    sharg::static_schema const schema{
+        sharg::static_option<'n', "numbers">(&test_options::numbers, sharg::config{.list_delimiter = ','})};
+
+    EXPECT_EQ(parse(schema, {"-n", "1,2", "--numbers=3", "-n4,5"}).numbers, (std::vector<int>{1, 2, 3, 4, 5}));
+    EXPECT_THROW(parse(schema, {"-n", "1,x"}), sharg::user_input_error);
+}
+
+TEST(static_schema_test, copy)
+{
+    auto const schema = make_schema();
+    auto const copy{schema};
+
+    EXPECT_EQ(parse(copy, {"-t", "3", "in", "a"}).threads, 3);
+}
+
+TEST(static_schema_test, concurrent_parse)
+{
+    auto const schema = make_schema();
+    size_t const thread_count = 8u;
+    size_t const parse_count = 500u;
+    std::vector<size_t> failures(thread_count);
+    std::vector<std::thread> threads{};
+
+    for (size_t t = 0; t < thread_count; ++t)
+    {
+        threads.emplace_back(
+            [&schema, &failure_count = failures[t], t]()
+            {
+                std::string const value = std::to_string(t + 1u);
+                std::string const file = "file" + value;
+                std::vector<std::string_view> const arguments{"-t", value, "-n", value, "in", file};
+
+                for (size_t i = 0; i < parse_count; ++i)
+                {
+                    test_options const options = schema.parse(arguments);
+                    int const expected = static_cast<int>(t + 1u);
+
+                    if (options.threads != expected || options.numbers != std::vector<int>{expected}
+                        || options.files != std::vector<std::string>{file})
+                        ++failure_count;
+                }
+            });
+    }
+
+    for (std::thread & thread : threads)
+        thread.join();
+
+    EXPECT_EQ(failures, std::vector<size_t>(thread_count, 0u));
+}
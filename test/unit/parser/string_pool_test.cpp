@@ -0,0 +1,159 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <gtest/gtest.h>
+
+#include <sharg/parser.hpp>
+#include <sharg/string_pool.hpp>
+#include <sharg/test/expect_throw_msg.hpp>
+#include <sharg/test/test_fixture.hpp>
+
+class string_pool_test : public sharg::test::test_fixture
+{};
+
+static_assert(std::ranges::random_access_range<sharg::string_pool const>);
+static_assert(std::ranges::sized_range<sharg::string_pool const>);
+static_assert(std::same_as<std::ranges::range_value_t<sharg::string_pool>, std::string_view>);
+static_assert(sharg::detail::is_container_option<sharg::string_pool>);
+static_assert(sharg::parsable<sharg::string_pool>);
+
+// Views would refer to the arguments stored by the parser, which are released with the parser.
+static_assert(!sharg::parsable<std::string_view>);
+static_assert(!sharg::parsable<std::span<char const>>);
+
+template <typename option_t>
+concept addable_option = requires (sharg::parser & parser, option_t & value) {
+    parser.add_option(value, sharg::config{.short_id = 'v'});
+};
+
+static_assert(addable_option<sharg::string_pool>);
+static_assert(!addable_option<std::vector<std::string_view>>);
+
+TEST_F(string_pool_test, container)
+{
+    sharg::string_pool pool{};
+    EXPECT_TRUE(pool.empty());
+    EXPECT_EQ(pool.begin(), pool.end());
+
+    pool.push_back("first");
+    pool.push_back("");
+    pool.push_back(std::string{"third"});
+    EXPECT_EQ(pool.size(), 3u);
+    EXPECT_EQ(pool.character_count(), 10u);
+    EXPECT_EQ(pool[0], "first");
+    EXPECT_EQ(pool[1], "");
+    EXPECT_EQ(pool.front(), "first");
+    EXPECT_EQ(pool.back(), "third");
+    EXPECT_EQ(pool.end() - pool.begin(), 3);
+    EXPECT_EQ(pool.begin()[2], "third");
+    EXPECT_TRUE(std::ranges::equal(pool, std::vector<std::string_view>{"first", "", "third"}));
+    EXPECT_EQ(pool, (sharg::string_pool{"first", "", "third"}));
+    EXPECT_NE(pool, (sharg::string_pool{"first", "third"}));
+
+    pool.clear();
+    EXPECT_TRUE(pool.empty());
+    EXPECT_EQ(pool.character_count(), 0u);
+}
+
+TEST_F(string_pool_test, parse)
+{
+    sharg::string_pool files{"default.fa"};
+    sharg::string_pool ids{};
+    sharg::string_pool positional{};
+
+    auto parser = get_parser("-f", "a.fa", "--ids", "x,y,", "--file=b.fa", "-ic", "p1", "p2");
+    parser.add_option(files, sharg::config{.short_id = 'f', .long_id = "file"});
+    parser.add_option(ids, sharg::config{.short_id = 'i', .long_id = "ids", .list_delimiter = ','});
+    parser.add_positional_option(positional, sharg::config{});
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_EQ(files, (sharg::string_pool{"a.fa", "b.fa"}));
+    EXPECT_EQ(ids, (sharg::string_pool{"x", "y", "", "c"}));
+    EXPECT_EQ(positional, (sharg::string_pool{"p1", "p2"}));
+}
+
+// The pool copies the arguments, i.e. it does not refer to the arguments stored by the parser.
+TEST_F(string_pool_test, outlives_parser)
+{
+    auto parse = []()
+    {
+        std::vector<std::string> arguments{"./string_pool_test", "-f", "a.fa", "b.fa"};
+        std::vector<char const *> argv{};
+        for (std::string const & argument : arguments)
+            argv.push_back(argument.c_str());
+
+        sharg::string_pool files{};
+        sharg::string_pool positional{};
+        sharg::parser parser{"test_parser",
+                             static_cast<int>(argv.size()),
+                             argv.data(),
+                             sharg::update_notifications::off};
+        parser.add_option(files, sharg::config{.short_id = 'f'});
+        parser.add_positional_option(positional, sharg::config{});
+        parser.parse();
+        return std::pair{files, positional};
+    };
+
+    auto [files, positional] = parse();
+    EXPECT_EQ(files, (sharg::string_pool{"a.fa"}));
+    EXPECT_EQ(positional, (sharg::string_pool{"b.fa"}));
+}
+
+TEST_F(string_pool_test, validators)
+{
+    sharg::string_pool values{};
+
+    auto parser = get_parser("-v", "a", "-v", "b");
+    parser.add_option(values, sharg::config{.short_id = 'v', .validator = sharg::value_list_validator{"a", "b"}});
+    EXPECT_NO_THROW(parser.parse());
+
+    parser = get_parser("-v", "a", "-v", "c");
+    parser.add_option(values, sharg::config{.short_id = 'v', .validator = sharg::value_list_validator{"a", "b"}});
+    EXPECT_THROW_MSG(parser.parse(),
+                     sharg::validation_error,
+                     "Validation failed for option -v: Value c is not one of [a, b].");
+
+    parser = get_parser("-v", "chr1,chrX", "-v", "chr2");
+    parser.add_option(values,
+                      sharg::config{.short_id = 'v',
+                                    .validator = sharg::regex_validator{"chr[0-9XY]+"},
+                                    .list_delimiter = ','});
+    EXPECT_NO_THROW(parser.parse());
+    EXPECT_EQ(values, (sharg::string_pool{"chr1", "chrX", "chr2"}));
+
+    parser = get_parser("-v", "chr1,contig");
+    parser.add_option(values,
+                      sharg::config{.short_id = 'v',
+                                    .validator = sharg::regex_validator{"chr[0-9XY]+"},
+                                    .list_delimiter = ','});
+    EXPECT_THROW(parser.parse(), sharg::validation_error);
+
+    for (bool const parallel : {false, true})
+    {
+        parser = get_parser("-v", "does_not_exist.fa");
+        parser.add_option(values,
+                          sharg::config{.short_id = 'v',
+                                        .validator = sharg::input_file_validator{},
+                                        .parallel_validation = parallel});
+        EXPECT_THROW(parser.parse(), sharg::validation_error);
+    }
+}
+
+TEST_F(string_pool_test, help_page)
+{
+    sharg::string_pool value{"a.fa", "b.fa"};
+
+    auto parser = get_parser("-h");
+    parser.add_option(value, sharg::config{.short_id = 'f', .long_id = "file"});
+    parser.add_positional_option(value, sharg::config{});
+    std::string const help_page = get_parse_cout_on_exit(parser);
+
+    EXPECT_NE(help_page.find("    ARGUMENT-1 (List of std::string_view)\n"
+                             "          Default: [\"a.fa\", \"b.fa\"]\n"),
+              std::string::npos)
+        << help_page;
+    EXPECT_NE(help_page.find("    -f, --file (List of std::string_view)\n"
+                             "          Default: [\"a.fa\", \"b.fa\"]\n"),
+              std::string::npos)
+        << help_page;
+}
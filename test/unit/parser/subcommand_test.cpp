@@ -71,6 +71,20 @@ TEST_F(subcommand_test, simple_option)
     EXPECT_EQ(value, "foo");
 }
 
+TEST_F(subcommand_test, sub_parser_shares_arguments)
+{
+    auto parser = get_subcommand_parser({"build", "-o", "foo"}, {"build"});
+    EXPECT_NO_THROW(parser.parse());
+
+    auto top_level_arguments = sharg::detail::test_accessor::arguments(parser);
+    auto sub_parser_arguments = sharg::detail::test_accessor::arguments(parser.get_sub_parser());
+
+    // The sub-parser refers to the arguments of the top-level parser instead of copying them.
+    ASSERT_EQ(sub_parser_arguments.size(), 3u);
+    EXPECT_EQ(sub_parser_arguments.data(), top_level_arguments.data() + 1);
+    EXPECT_EQ(sub_parser_arguments[2], "foo");
+}
+
 TEST_F(subcommand_test, subcommand_is_option_value)
 {
     auto parser = get_subcommand_parser({"-o", "build", "build", "-o", "build"}, {"build"});